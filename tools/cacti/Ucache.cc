@@ -44,16 +44,33 @@
 #include "Ucache.h"
 #include "subarray.h"
 #include "uca.h"
+#include "mat.h"
+#include "thread_pool.h"
+#include "partition_memo.h"
+#include "arena.h"
+#include "pareto.h"
+#include "design_dump.h"
+#include "profile.h"
 
-#include <pthread.h>
 #include <iostream>
 #include <algorithm>
 #include <list>
 
 using namespace std;
 
-const uint32_t nthreads = NTHREADS;
+// slack for rounding when a bound is compared with a computed value
+#define PRUNE_MARGIN (1 + 1e-9)
+// valid partitions each sweep slot makes room for up front, and the words
+// of a typical packed record
+#define PARTITION_SLOT_RESERVE 1024
+#define PARTITION_PACKED_WORDS 128
 
+static bool partition_pruning = false;
+
+void set_partition_pruning(bool on)
+{
+  partition_pruning = on;
+}
 
 void min_values_t::update_min_values(const min_values_t * val)
 {
@@ -95,34 +112,32 @@ void min_values_t::update_min_values(const mem_array * res)
 
 
 
-void * calc_time_mt_wrapper(void * void_obj)
+// Enumerate the partitions one sweep has to visit. Candidates are numbered
+// in the order of the original nested loops (Nspd, wire type, Ndwl, Ndbl,
+// Ndcm, Ndsam_lev_1, Ndsam_lev_2) so that the result lists do not depend on
+// how the pool happens to schedule them.
+void init_partition_sweep(
+    calc_time_mt_wrapper_struct & sweep,
+    bool is_tag,
+    bool is_main_mem,
+    double Nspd_min)
 {
-  calc_time_mt_wrapper_struct * calc_obj = (calc_time_mt_wrapper_struct *) void_obj;
-  uint32_t tid                   = calc_obj->tid;
-  list<mem_array *> & data_arr   = calc_obj->data_arr;
-  list<mem_array *> & tag_arr    = calc_obj->tag_arr;
-  bool is_tag                    = calc_obj->is_tag;
-  bool pure_ram                  = calc_obj->pure_ram;
-  bool pure_cam					 = calc_obj->pure_cam;
-  bool is_main_mem               = calc_obj->is_main_mem;
-  double Nspd_min                = calc_obj->Nspd_min;
-  min_values_t * data_res        = calc_obj->data_res;
-  min_values_t * tag_res         = calc_obj->tag_res;
-
-  data_arr.clear();
-  data_arr.push_back(new mem_array);
-  tag_arr.clear();
-  tag_arr.push_back(new mem_array);
-
   uint32_t Ndwl_niter = _log2(MAXDATAN) + 1;
   uint32_t Ndbl_niter = _log2(MAXDATAN) + 1;
   uint32_t Ndcm_niter = _log2(MAX_COL_MUX) + 1;
   uint32_t niter      = Ndwl_niter * Ndbl_niter * Ndcm_niter;
-
-
-  bool is_valid_partition;
   int wt_min, wt_max;
 
+  sweep.is_tag      = is_tag;
+  sweep.is_main_mem = is_main_mem;
+  sweep.Nspd.clear();
+  sweep.wt.clear();
+  sweep.Ndwl.clear();
+  sweep.Ndbl.clear();
+  sweep.Ndcm.clear();
+  sweep.Ndsam_lev_1.clear();
+  sweep.Ndsam_lev_2.clear();
+
   if (g_ip->force_wiretype) {
     if (g_ip->wt == Full_swing) {
       wt_min = Global;
@@ -159,98 +174,274 @@ void * calc_time_mt_wrapper(void * void_obj)
     wt_max = Low_swing;
   }
 
-  for (double Nspd = Nspd_min; Nspd <= MAXDATASPD; Nspd *= 2)
+  //for debuging
+  bool forced = (g_ip->force_cache_config && is_tag == false);
+
+  if (forced && g_ip->nspd != 0)
+  {
+    sweep.Nspd.push_back(g_ip->nspd);
+  }
+  else
+  {
+    for (double Nspd = Nspd_min; Nspd <= MAXDATASPD; Nspd *= 2)
+    {
+      sweep.Nspd.push_back(Nspd);
+    }
+  }
+
+  if (forced)
+  {
+    sweep.wt.push_back(g_ip->wt);
+    sweep.Ndwl.push_back(g_ip->ndwl);
+    sweep.Ndbl.push_back(g_ip->ndbl);
+    sweep.Ndcm.push_back(g_ip->ndcm);
+  }
+  else
   {
     for (int wr = wt_min; wr <= wt_max; wr++)
     {
-      for (uint32_t iter = tid; iter < niter; iter += nthreads)
+      sweep.wt.push_back(wr);
+    }
+    for (uint32_t iter = 0; iter < niter; iter++)
+    {
+      // reconstruct Ndwl, Ndbl, Ndcm
+      sweep.Ndwl.push_back(1 << (iter / (Ndbl_niter * Ndcm_niter)));
+      sweep.Ndbl.push_back(1 << ((iter / (Ndcm_niter))%Ndbl_niter));
+      sweep.Ndcm.push_back(1 << (iter % Ndcm_niter));
+    }
+  }
+
+  if (forced && g_ip->ndsam1 != 0)
+  {
+    sweep.Ndsam_lev_1.push_back(g_ip->ndsam1);
+    sweep.Ndsam_lev_2.push_back(g_ip->ndsam2);
+  }
+  else if (is_tag == false && g_ip->is_3d_mem)
+  {
+    sweep.Ndsam_lev_1.push_back(1);
+    sweep.Ndsam_lev_2.push_back(1);
+  }
+  else
+  {
+    for(unsigned int Ndsam_lev_1 = 1; Ndsam_lev_1 <= MAX_COL_MUX; Ndsam_lev_1 *= 2)
+    {
+      for(unsigned int Ndsam_lev_2 = 1; Ndsam_lev_2 <= MAX_COL_MUX; Ndsam_lev_2 *= 2)
       {
-        // reconstruct Ndwl, Ndbl, Ndcm
-        unsigned int Ndwl = 1 << (iter / (Ndbl_niter * Ndcm_niter));
-        unsigned int Ndbl = 1 << ((iter / (Ndcm_niter))%Ndbl_niter);
-        unsigned int Ndcm = 1 << (iter % Ndcm_niter);
-        for(unsigned int Ndsam_lev_1 = 1; Ndsam_lev_1 <= MAX_COL_MUX; Ndsam_lev_1 *= 2)
-        {
-          for(unsigned int Ndsam_lev_2 = 1; Ndsam_lev_2 <= MAX_COL_MUX; Ndsam_lev_2 *= 2)
-          {
-            //for debuging
-            if (g_ip->force_cache_config && is_tag == false)
-            {
-              wr   = g_ip->wt;
-              Ndwl = g_ip->ndwl;
-              Ndbl = g_ip->ndbl;
-              Ndcm = g_ip->ndcm;
-              if(g_ip->nspd != 0) {
-            	  Nspd = g_ip->nspd;
-              }
-              if(g_ip->ndsam1 != 0) {
-            	  Ndsam_lev_1 = g_ip->ndsam1;
-            	  Ndsam_lev_2 = g_ip->ndsam2;
-              }
-            }
-
-            if (is_tag == true)
-            {
-              is_valid_partition = calculate_time(is_tag, pure_ram, pure_cam, Nspd, Ndwl,
-                  Ndbl, Ndcm, Ndsam_lev_1, Ndsam_lev_2,
-                  tag_arr.back(), 0, NULL, NULL,(Wire_type) wr,
-                  is_main_mem);
-            }
-            // If it's a fully-associative cache, the data array partition parameters are identical to that of
-            // the tag array, so compute data array partition properties also here.
-            if (is_tag == false || g_ip->fully_assoc)
-            {
-              is_valid_partition = calculate_time(is_tag/*false*/, pure_ram, pure_cam, Nspd, Ndwl,
-                  Ndbl, Ndcm, Ndsam_lev_1, Ndsam_lev_2,
-                  data_arr.back(), 0, NULL, NULL,(Wire_type) wr,
-                  is_main_mem);
-              if (g_ip->is_3d_mem)
-              {
-            	  Ndsam_lev_1 = MAX_COL_MUX+1;
-            	  Ndsam_lev_2 = MAX_COL_MUX+1;
-              }
-            }
-
-            if (is_valid_partition)
-            {
-              if (is_tag == true)
-              {
-                tag_arr.back()->wt = (enum Wire_type) wr;
-                tag_res->update_min_values(tag_arr.back());
-                tag_arr.push_back(new mem_array);
-              }
-              if (is_tag == false || g_ip->fully_assoc)
-              {
-                data_arr.back()->wt = (enum Wire_type) wr;
-                data_res->update_min_values(data_arr.back());
-                data_arr.push_back(new mem_array);
-              }
-            }
-
-            if (g_ip->force_cache_config && is_tag == false)
-            {
-            	wr   = wt_max;
-            	iter = niter;
-            	if(g_ip->nspd != 0) {
-            		Nspd = MAXDATASPD;
-            	}
-            	if (g_ip->ndsam1 != 0) {
-            		Ndsam_lev_1 = MAX_COL_MUX+1;
-            		Ndsam_lev_2 = MAX_COL_MUX+1;
-            	}
-            }
-          }
-        }
+        sweep.Ndsam_lev_1.push_back(Ndsam_lev_1);
+        sweep.Ndsam_lev_2.push_back(Ndsam_lev_2);
       }
     }
   }
+}
+
+
+
+uint64_t partition_sweep_size(const calc_time_mt_wrapper_struct & sweep)
+{
+  return (uint64_t) sweep.Nspd.size() * sweep.wt.size() * sweep.Ndwl.size() * sweep.Ndsam_lev_1.size();
+}
+
+
+
+// Evaluate candidate idx of the sweep on behalf of pool slot "slot".
+void calc_time_mt_wrapper(void * void_obj, uint64_t idx, uint32_t slot)
+{
+  calc_time_mt_wrapper_struct * calc_obj = (calc_time_mt_wrapper_struct *) void_obj;
+  calc_time_slot & res = calc_obj->slot[slot];
+
+  uint64_t i       = idx;
+  uint32_t i_ndsam = i % calc_obj->Ndsam_lev_1.size(); i /= calc_obj->Ndsam_lev_1.size();
+  uint32_t i_part  = i % calc_obj->Ndwl.size();        i /= calc_obj->Ndwl.size();
+  uint32_t i_wt    = i % calc_obj->wt.size();          i /= calc_obj->wt.size();
+  int      wr      = calc_obj->wt[i_wt];
+
+  if (res.spare == NULL)
+  {
+    res.spare = new mem_array();  // zeroed: some fields are only set with power gating
+  }
+
+  // the candidate's component tree is dropped with the scope once its
+  // metrics are in res.spare
+  ArenaScope scope;
+  bool built = false;
+  bool is_valid_partition = calculate_time(calc_obj->is_tag, calc_obj->pure_ram, calc_obj->pure_cam,
+      calc_obj->Nspd[i], calc_obj->Ndwl[i_part], calc_obj->Ndbl[i_part], calc_obj->Ndcm[i_part],
+      calc_obj->Ndsam_lev_1[i_ndsam], calc_obj->Ndsam_lev_2[i_ndsam],
+      res.spare, 0, NULL, NULL, (Wire_type) wr,
+      calc_obj->is_main_mem, calc_obj->prune ? &res.min_res : NULL, &built);
+  res.evaluated += built;
+
+  if (is_valid_partition)
+  {
+    res.spare->wt = (enum Wire_type) wr;
+    res.min_res.update_min_values(res.spare);
+    res.rank.push_back(mem_array_rank(idx, res.packed.size(), *res.spare));
+    res.spare->pack(res.packed);
+    *res.spare = mem_array();
+  }
+}
 
-  delete data_arr.back();
-  delete tag_arr.back();
-  data_arr.pop_back();
-  tag_arr.pop_back();
 
-  pthread_exit(NULL);
+
+mem_array_rank::mem_array_rank(uint64_t idx_, uint64_t pos_, const mem_array & m)
+  : Nspd(m.Nspd), Ndwl(m.Ndwl), Ndbl(m.Ndbl), deg_bl_muxing(m.deg_bl_muxing),
+    Ndsam_lev_1(m.Ndsam_lev_1), Ndsam_lev_2(m.Ndsam_lev_2),
+    access_time(m.access_time), cycle_time(m.cycle_time),
+    dyn(m.power.readOp.dynamic), leakage(m.power.readOp.leakage), area(m.area),
+    idx(idx_), pos(pos_), detail(NULL)
+{
+}
+
+
+
+bool mem_array_rank::lt(const mem_array_rank & r1, const mem_array_rank & r2)
+{
+  if (r1.Nspd != r2.Nspd) return r1.Nspd < r2.Nspd;
+  if (r1.Ndwl != r2.Ndwl) return r1.Ndwl < r2.Ndwl;
+  if (r1.Ndbl != r2.Ndbl) return r1.Ndbl < r2.Ndbl;
+  if (r1.deg_bl_muxing != r2.deg_bl_muxing) return r1.deg_bl_muxing < r2.deg_bl_muxing;
+  if (r1.Ndsam_lev_1 != r2.Ndsam_lev_1) return r1.Ndsam_lev_1 < r2.Ndsam_lev_1;
+  if (r1.Ndsam_lev_2 != r2.Ndsam_lev_2) return r1.Ndsam_lev_2 < r2.Ndsam_lev_2;
+  return r1.idx < r2.idx;
+}
+
+
+
+// Point the ranking view of a slot at its records and sort it.
+static void sort_partition_slot(void * void_obj, uint64_t idx, uint32_t)
+{
+  calc_time_slot & res = ((calc_time_mt_wrapper_struct *) void_obj)->slot[idx];
+
+  for (uint32_t i = 0; i < res.rank.size(); i++)
+  {
+    res.rank[i].detail = &res.packed[res.rank[i].pos];
+  }
+  sort(res.rank.begin(), res.rank.end(), mem_array_rank::lt);
+}
+
+
+
+// heap order for the k-way merge: the smallest head on top
+struct merge_head
+{
+  const vector<mem_array_rank> * run;
+  uint32_t pos;
+
+  bool operator<(const merge_head & h) const
+  {
+    return mem_array_rank::lt((*h.run)[h.pos], (*run)[pos]);
+  }
+};
+
+
+
+// Run all candidates of the sweep on the thread pool, or read them from the
+// partition memo. The ranking view of the valid partitions is returned in
+// arr, ordered by mem_array_rank::lt, and their minimum values are folded
+// into min_res. The full records stay in the sweep slots until
+// release_partition_sweep().
+void run_partition_sweep(
+    calc_time_mt_wrapper_struct & sweep,
+    vector<mem_array_rank> & arr,
+    min_values_t * min_res)
+{
+  ThreadPool & pool = ThreadPool::instance();
+  PartitionMemo * memo = PartitionMemo::open(sweep);
+  uint64_t count = 0;
+  uint64_t evaluated = 0;
+  bool     from_memo = false;
+
+  release_partition_sweep(sweep);
+  if (memo != NULL && memo->load(sweep))
+  {
+    from_memo = true;
+    for (uint32_t t = 0; t < sweep.slot.size(); t++)
+    {
+      count += sweep.slot[t].rank.size();
+      min_res->update_min_values(&sweep.slot[t].min_res);
+    }
+  }
+  else
+  {
+    sweep.slot.resize(pool.num_slots());
+    for (uint32_t t = 0; t < sweep.slot.size(); t++)
+    {
+      sweep.slot[t].packed.reserve(PARTITION_SLOT_RESERVE * PARTITION_PACKED_WORDS);
+      sweep.slot[t].rank.reserve(PARTITION_SLOT_RESERVE);
+    }
+
+    pool.parallel_for(partition_sweep_size(sweep), calc_time_mt_wrapper, (void *) &sweep);
+
+    for (uint32_t t = 0; t < sweep.slot.size(); t++)
+    {
+      calc_time_slot & res = sweep.slot[t];
+      count += res.rank.size();
+      evaluated += res.evaluated;
+      min_res->update_min_values(&res.min_res);
+      delete res.spare;
+      res.spare = NULL;
+    }
+  }
+
+  // each slot sorts its own run, then the runs are merged
+  pool.parallel_for(sweep.slot.size(), sort_partition_slot, (void *) &sweep);
+
+  vector<merge_head> heads;
+  for (uint32_t t = 0; t < sweep.slot.size(); t++)
+  {
+    if (!sweep.slot[t].rank.empty())
+    {
+      merge_head h = { &sweep.slot[t].rank, 0 };
+      heads.push_back(h);
+    }
+  }
+  make_heap(heads.begin(), heads.end());
+
+  arr.clear();
+  arr.reserve(count);
+  while (!heads.empty())
+  {
+    pop_heap(heads.begin(), heads.end());
+    merge_head & h = heads.back();
+    arr.push_back((*h.run)[h.pos]);
+    if (++h.pos < h.run->size())
+    {
+      push_heap(heads.begin(), heads.end());
+    }
+    else
+    {
+      heads.pop_back();
+    }
+  }
+
+  if (memo != NULL && !from_memo)
+  {
+    memo->save(arr);
+  }
+  delete memo;
+
+  if (DesignDump::enabled())
+  {
+    DesignDump::write(sweep, arr);
+  }
+
+  Profiler::count(sweep.is_tag ? PROF_TAG_ENUMERATED : PROF_DATA_ENUMERATED,
+      from_memo ? 0 : partition_sweep_size(sweep));
+  Profiler::count(sweep.is_tag ? PROF_TAG_EVALUATED : PROF_DATA_EVALUATED, evaluated);
+  Profiler::count(sweep.is_tag ? PROF_TAG_VALID : PROF_DATA_VALID, count);
+}
+
+
+
+// Free the records of the last sweep; ranking views taken from it become
+// invalid.
+void release_partition_sweep(calc_time_mt_wrapper_struct & sweep)
+{
+  for (uint32_t t = 0; t < sweep.slot.size(); t++)
+  {
+    delete sweep.slot[t].spare;
+  }
+  sweep.slot.clear();
 }
 
 
@@ -270,7 +461,9 @@ bool calculate_time(
     results_mem_array *ptr_results,
     uca_org_t *ptr_fin_res,
     Wire_type wt, // merge from cacti-7 to cacti3d
-    bool is_main_mem)
+    bool is_main_mem,
+    const min_values_t * prune_min,
+    bool * built)
 {
   DynamicParameter dyn_p(is_tag, pure_ram, pure_cam, Nspd, Ndwl, Ndbl, Ndcm, Ndsam_lev_1, Ndsam_lev_2, wt, is_main_mem);
 
@@ -279,7 +472,43 @@ bool calculate_time(
     return false;
   }
 
-  UCA * uca = new UCA(dyn_p);
+  double min_delay_bound = 0, mat_energy_bound = 0, htree_energy_bound = 0;
+  if (prune_min != NULL && !is_tag)
+  {
+    // filter_data_arr() drops arrays that are more than 50% above the
+    // minimum delay and the minimum read energy, so an array whose lower
+    // bounds already are can neither survive it nor set a new minimum
+    UCA::bounds(dyn_p, min_delay_bound, mat_energy_bound, htree_energy_bound);
+    if (min_delay_bound > 1.5 * PRUNE_MARGIN * prune_min->min_delay &&
+        mat_energy_bound + htree_energy_bound > 1.5 * PRUNE_MARGIN * prune_min->min_dyn)
+    {
+      return false;
+    }
+  }
+
+  if (built != NULL)
+  {
+    *built = true;
+  }
+
+  // when pruning, area and delay come first; the power pass only runs for
+  // arrays that the exact access time and H-tree energies do not already
+  // rule out
+  UCA * uca = new UCA(dyn_p, prune_min != NULL && !is_tag);
+  if (uca->power_deferred)
+  {
+    htree_energy_bound = uca->htree_in_add->power.readOp.dynamic +
+                         uca->htree_out_data->power.readOp.dynamic +
+                         uca->bank.htree_in_add->power.readOp.dynamic +
+                         uca->bank.htree_out_data->power.readOp.dynamic;
+    if (uca->access_time > 1.5 * PRUNE_MARGIN * prune_min->min_delay &&
+        mat_energy_bound + htree_energy_bound > 1.5 * PRUNE_MARGIN * prune_min->min_dyn)
+    {
+      delete uca;
+      return false;
+    }
+    uca->compute_power_energy();
+  }
 
 
   if (flag_results_populate)
@@ -294,6 +523,7 @@ bool calculate_time(
 	ptr_array->Ndwl = Ndwl;
     ptr_array->Ndbl = Ndbl;
     ptr_array->Nspd = Nspd;
+    ptr_array->Ndcm = Ndcm;
     ptr_array->deg_bl_muxing = dyn_p.deg_bl_muxing;
     ptr_array->Ndsam_lev_1 = Ndsam_lev_1;
     ptr_array->Ndsam_lev_2 = Ndsam_lev_2;
@@ -654,7 +884,7 @@ bool check_mem_org(mem_array & u, const min_values_t *minval)
 
 
 
-void find_optimal_uca(uca_org_t *res, min_values_t * minval, list<uca_org_t> & ulist)
+bool find_optimal_uca(uca_org_t *res, min_values_t * minval, list<uca_org_t> & ulist)
 {
   double cost = 0;
   double min_cost = BIGNUM;
@@ -669,7 +899,7 @@ void find_optimal_uca(uca_org_t *res, min_values_t * minval, list<uca_org_t> & u
   if (ulist.empty() == true)
   {
     cout << "ERROR: no valid cache organizations found" << endl;
-    exit(0);
+    return false;
   }
 
   for (list<uca_org_t>::iterator niter = ulist.begin(); niter != ulist.end(); niter++)
@@ -731,36 +961,168 @@ void find_optimal_uca(uca_org_t *res, min_values_t * minval, list<uca_org_t> & u
   if (min_cost == BIGNUM)
   {
     cout << "ERROR: no cache organizations met optimization criteria" << endl;
-    exit(0);
+    return false;
   }
+  return true;
+}
+
+
+
+// organizations evaluated by one combine_tag_data() task
+#define COMBINE_CHUNK 256
+
+// The organization find_optimal_uca() is sure to skip when it filters by the
+// deviation limits: erasing the head of its list steps over the second one.
+// It is kept in place and never counts as dominating another.
+#define COMBINE_SKIPPED 1
+
+static void uca_org_metrics(uca_combine_struct & comb, uint32_t i, uca_org_t & org)
+{
+  org.tag_array2  = comb.tag[i / comb.data.size()];
+  org.data_array2 = comb.data[i % comb.data.size()];
+  org.find_delay();
+  org.find_energy();
+  org.find_area();
+  org.find_cyc();
 }
 
 
 
-void filter_tag_arr(const min_values_t * min, list<mem_array *> & list)
+// Add org i to front unless an earlier one on it dominates it; members the
+// new one dominates leave the front, as it now stands in for them.
+static bool add_to_front(vector<uca_org_cost> & front, uint32_t i, const uca_org_cost & c, bool prune)
+{
+  if (!prune || i == COMBINE_SKIPPED)
+  {
+    return true;
+  }
+  for (uint32_t k = 0; k < front.size(); k++)
+  {
+    if (front[k].dominates(c))
+    {
+      return false;
+    }
+  }
+  uint32_t n = 0;
+  for (uint32_t k = 0; k < front.size(); k++)
+  {
+    if (!c.dominates(front[k]))
+    {
+      front[n++] = front[k];
+    }
+  }
+  front.resize(n);
+  front.push_back(c);
+  return true;
+}
+
+
+
+static void combine_tag_data_chunk(void * void_obj, uint64_t chunk, uint32_t)
+{
+  uca_combine_struct & comb = *(uca_combine_struct *) void_obj;
+  uint32_t begin = chunk * COMBINE_CHUNK;
+  uint32_t end   = MIN(begin + COMBINE_CHUNK, comb.tag.size() * comb.data.size());
+  vector<uca_org_cost> front;
+
+  for (uint32_t i = begin; i < end; i++)
+  {
+    uca_org_t org;
+    uca_org_metrics(comb, i, org);
+    comb.min_res[chunk].update_min_values(org);
+
+    uca_org_cost c = { org.access_time, org.cycle_time, org.power.readOp.dynamic,
+                       org.power.readOp.leakage, org.area };
+    if (add_to_front(front, i, c, comb.prune_dominated))
+    {
+      comb.kept[chunk].push_back(i);
+      comb.cost[chunk].push_back(c);
+    }
+  }
+}
+
+
+
+// Evaluate every tag x data organization on the thread pool and fold their
+// metrics into min_res. Each chunk leaves in comb.kept and comb.cost those
+// it did not drop on its own.
+static void evaluate_tag_data(uca_combine_struct & comb, min_values_t * min_res)
+{
+  uint32_t n      = comb.tag.size() * comb.data.size();
+  uint32_t chunks = (n + COMBINE_CHUNK - 1) / COMBINE_CHUNK;
+
+  comb.kept.assign(chunks, vector<uint32_t>());
+  comb.cost.assign(chunks, vector<uca_org_cost>());
+  comb.min_res.assign(chunks, min_values_t());
+
+  ThreadPool::instance().parallel_for(chunks, combine_tag_data_chunk, (void *) &comb);
+
+  for (uint32_t c = 0; c < chunks; c++)
+  {
+    min_res->update_min_values(&comb.min_res[c]);
+  }
+  comb.min_res.clear();
+}
+
+
+
+// Evaluate every tag x data organization, fold their metrics into min_res
+// and leave in ulist, in pairing order, those find_optimal_uca() may pick.
+// With comb.prune_dominated, an organization that an earlier one is no
+// worse than in every metric is dropped: the earlier one passes any
+// deviation check it passes and costs no more under any non-negative
+// weights, and find_optimal_uca() keeps the first of equal costs.
+void combine_tag_data(uca_combine_struct & comb, min_values_t * min_res, list<uca_org_t> & ulist)
+{
+  evaluate_tag_data(comb, min_res);
+
+  // chunks were filtered on their own; filter again across them, in order
+  vector<uca_org_cost> front;
+  ulist.clear();
+  for (uint32_t c = 0; c < comb.kept.size(); c++)
+  {
+    for (uint32_t k = 0; k < comb.kept[c].size(); k++)
+    {
+      uint32_t i = comb.kept[c][k];
+      if (add_to_front(front, i, comb.cost[c][k], comb.prune_dominated))
+      {
+        ulist.push_back(uca_org_t());
+        uca_org_metrics(comb, i, ulist.back());
+      }
+    }
+  }
+  comb.kept.clear();
+  comb.cost.clear();
+}
+
+
+
+// Pick the tag array of least cost among those within the deviation
+// limits, scanning from the back of the list; the list is left as is.
+bool filter_tag_arr(const min_values_t * min, const list<mem_array *> & list, mem_array * & res)
 {
   double cost = BIGNUM;
   double cur_cost;
   double wt_delay = g_ip->delay_wt, wt_dyn = g_ip->dynamic_power_wt, wt_leakage = g_ip->leakage_power_wt, wt_cyc = g_ip->cycle_time_wt, wt_area = g_ip->area_wt;
-  mem_array * res = NULL;
+  res = NULL;
 
   if (list.empty() == true)
   {
     cout << "ERROR: no valid tag organizations found" << endl;
-    exit(1);
+    return false;
   }
 
 
-  while (list.empty() != true)
+  for (std::list<mem_array *>::const_reverse_iterator it = list.rbegin(); it != list.rend(); ++it)
   {
-    bool v = check_mem_org(*list.back(), min);
+    bool v = check_mem_org(**it, min);
     if (v)
     {
-      cur_cost = wt_delay   * (list.back()->access_time/min->min_delay) +
-        wt_dyn     * (list.back()->power.readOp.dynamic/min->min_dyn) +
-        wt_leakage * (list.back()->power.readOp.leakage/min->min_leakage) +
-        wt_area    * (list.back()->area/min->min_area) +
-        wt_cyc     * (list.back()->cycle_time/min->min_cyc);
+      cur_cost = wt_delay   * ((*it)->access_time/min->min_delay) +
+        wt_dyn     * ((*it)->power.readOp.dynamic/min->min_dyn) +
+        wt_leakage * ((*it)->power.readOp.leakage/min->min_leakage) +
+        wt_area    * ((*it)->area/min->min_area) +
+        wt_cyc     * ((*it)->cycle_time/min->min_cyc);
     }
     else
     {
@@ -768,54 +1130,224 @@ void filter_tag_arr(const min_values_t * min, list<mem_array *> & list)
     }
     if (cur_cost < cost)
     {
-      if (res != NULL)
-      {
-        delete res;
-      }
       cost = cur_cost;
-      res  = list.back();
-    }
-    else
-    {
-      delete list.back();
+      res  = *it;
     }
-    list.pop_back();
   }
   if(!res)
   {
     cout << "ERROR: no valid tag organizations found" << endl;
-    exit(0);
+    return false;
   }
-
-  list.push_back(res);
+  return true;
 }
 
 
 
-void filter_data_arr(list<mem_array *> & curr_list)
+// Copy the data arrays that are within 50% of the minimum delay or of the
+// minimum read energy into curr_list, in the order of arr.
+bool filter_data_arr(const vector<mem_array_rank> & arr, min_values_t * min, list<mem_array *> & curr_list)
 {
-  if (curr_list.empty() == true)
+  if (arr.empty() == true)
   {
     cout << "ERROR: no valid data array organizations found" << endl;
-    exit(1);
+    return false;
   }
 
-  list<mem_array *>::iterator iter;
+  for (uint32_t i = 0; i < arr.size(); i++)
+  {
+    const mem_array_rank & m = arr[i];
 
-  for (iter = curr_list.begin(); iter != curr_list.end(); ++iter)
+    if(((m.access_time - min->min_delay)/min->min_delay > 0.5) &&
+       ((m.dyn - min->min_dyn)/min->min_dyn > 0.5))
+    {
+      continue;
+    }
+    curr_list.push_back(new mem_array());
+    m.get_detail(*curr_list.back());
+    curr_list.back()->arr_min = min;
+  }
+  return true;
+}
+
+
+
+solve_candidates::~solve_candidates()
+{
+  list<mem_array *>::iterator miter;
+  for (miter = tag_arr.begin(); miter != tag_arr.end(); ++miter)
+  {
+    delete *miter;
+  }
+  for (miter = data_arr.begin(); miter != data_arr.end(); ++miter)
   {
-    mem_array * m = *iter;
+    delete *miter;
+  }
+}
 
-    if (m == NULL) exit(1);
 
-    if(((m->access_time - m->arr_min->min_delay)/m->arr_min->min_delay > 0.5) &&
-       ((m->power.readOp.dynamic - m->arr_min->min_dyn)/m->arr_min->min_dyn > 0.5))
+
+// Whether a tag array is no worse than b in every metric filter_tag_arr()
+// ranks it by, or a data array no worse than b in everything the metrics
+// of an organization grow with (see uca_org_t::find_delay()).
+static bool array_dominates(const mem_array & a, const mem_array & b, bool is_tag)
+{
+  if (is_tag)
+  {
+    return a.access_time <= b.access_time && a.cycle_time <= b.cycle_time &&
+           a.power.readOp.dynamic <= b.power.readOp.dynamic &&
+           a.power.readOp.leakage <= b.power.readOp.leakage && a.area <= b.area;
+  }
+  if (g_ip->pure_ram || g_ip->pure_cam || g_ip->fully_assoc ||
+      g_ip->fast_access || g_ip->is_seq_acc)
+  {
+    if (a.access_time > b.access_time)
+    {
+      return false;
+    }
+  }
+  else if (a.delay_senseamp_mux_decoder > b.delay_senseamp_mux_decoder ||
+           a.delay_before_subarray_output_driver > b.delay_before_subarray_output_driver ||
+           a.delay_from_subarray_output_driver_to_output > b.delay_from_subarray_output_driver_to_output)
+  {
+    return false;
+  }
+  return a.cycle_time <= b.cycle_time &&
+         a.power.readOp.dynamic <= b.power.readOp.dynamic &&
+         a.power.readOp.leakage <= b.power.readOp.leakage &&
+         a.height <= b.height && a.width <= b.width;
+}
+
+
+
+// Add m to the arrays of front unless one of them dominates it; those it
+// dominates are deleted.
+static void add_array_to_front(list<mem_array *> & front, const mem_array & m, bool is_tag)
+{
+  for (list<mem_array *>::iterator it = front.begin(); it != front.end(); ++it)
+  {
+    if (array_dominates(**it, m, is_tag))
+    {
+      return;
+    }
+  }
+  for (list<mem_array *>::iterator it = front.begin(); it != front.end(); )
+  {
+    if (array_dominates(m, **it, is_tag))
+    {
+      delete *it;
+      it = front.erase(it);
+    }
+    else
     {
-      delete m;
-      iter = curr_list.erase(iter);
-      iter --;
+      ++it;
     }
   }
+  front.push_back(new mem_array(m));
+}
+
+
+
+// Write the Pareto front of the organizations solve() may pick, whatever the
+// weights and deviation limits: every data array filter_data_arr() kept,
+// paired with every tag array filter_tag_arr() may pick, i.e. any that no
+// other one beats in all of its metrics. Data arrays that another one
+// dominates add no point to the front and are left out before pairing.
+static void write_pareto_front(const solve_candidates & cand)
+{
+  list<mem_array *>::const_iterator it;
+  list<mem_array *> tag_front;
+  list<mem_array *> data_front;
+
+  for (it = cand.tag_arr.begin(); it != cand.tag_arr.end(); ++it)
+  {
+    add_array_to_front(tag_front, **it, true);
+  }
+  for (it = cand.data_arr.begin(); it != cand.data_arr.end(); ++it)
+  {
+    add_array_to_front(data_front, **it, false);
+  }
+
+  uca_combine_struct comb;
+  min_values_t       min_res;
+  if (g_ip->pure_ram || g_ip->pure_cam || g_ip->fully_assoc)
+  {
+    comb.tag.push_back(NULL);
+  }
+  else
+  {
+    comb.tag.assign(tag_front.begin(), tag_front.end());
+  }
+  comb.data.assign(data_front.begin(), data_front.end());
+  comb.prune_dominated = true;
+  evaluate_tag_data(comb, &min_res);
+  ParetoFront::write(comb);
+
+  for (uint32_t i = 0; i < comb.tag.size(); i++)
+  {
+    delete comb.tag[i];
+  }
+  for (uint32_t i = 0; i < comb.data.size(); i++)
+  {
+    delete comb.data[i];
+  }
+}
+
+
+
+// Steps 3 and 4 of solve(): pair the candidates and pick the organization of
+// least cost under the current weights, deviation limits and ed. The
+// arrays fin_res ends up with are copies owned by the caller.
+static bool rank_candidates(const solve_candidates & cand, uca_org_t *fin_res, bool exit_on_error)
+{
+  ProfilePhase prof(PROF_COMBINE);
+  bool pure_ram = g_ip->pure_ram;
+  bool pure_cam = g_ip->pure_cam;
+  list<uca_org_t> sol_list;
+  min_values_t    cache_min;
+  mem_array *     tag_res = NULL;
+
+  fin_res->tag_array.access_time = 0;
+  fin_res->tag_array.Ndwl = 0;
+  fin_res->tag_array.Ndbl = 0;
+  fin_res->tag_array.Nspd = 0;
+  fin_res->tag_array.deg_bl_muxing = 0;
+  fin_res->tag_array.Ndsam_lev_1 = 0;
+  fin_res->tag_array.Ndsam_lev_2 = 0;
+
+  if (!(pure_ram||pure_cam||g_ip->fully_assoc))
+  {
+    if (!filter_tag_arr(&cand.t_min, cand.tag_arr, tag_res))
+    {
+      if (exit_on_error) exit(1);
+      fin_res->valid = false;
+      return false;
+    }
+    Profiler::count(PROF_TAG_FILTERED, cand.tag_arr.size() - 1);
+  }
+
+  uca_combine_struct comb;
+  comb.tag.push_back(tag_res);
+  comb.data.assign(cand.data_arr.begin(), cand.data_arr.end());
+  comb.prune_dominated = g_ip->delay_wt >= 0 && g_ip->dynamic_power_wt >= 0 &&
+                         g_ip->leakage_power_wt >= 0 && g_ip->cycle_time_wt >= 0 &&
+                         g_ip->area_wt >= 0;
+  combine_tag_data(comb, &cache_min, sol_list);
+  Profiler::count(PROF_ORGS_COMBINED, sol_list.size());
+
+  bool found = find_optimal_uca(fin_res, &cache_min, sol_list);
+  if (!found && exit_on_error) exit(0);
+
+  if (found)
+  {
+    fin_res->data_array2 = new mem_array(*fin_res->data_array2);
+    if (fin_res->tag_array2 != NULL)
+    {
+      fin_res->tag_array2 = new mem_array(*fin_res->tag_array2);
+    }
+  }
+  fin_res->valid = found;
+  return found;
 }
 
 
@@ -831,8 +1363,14 @@ void filter_data_arr(list<mem_array *> & curr_list)
  *    cache organizations are calculated based on the
  *    above results
  * 4. Cache model with least cost is picked from sol_list
+ *
+ * The results of steps 1 and 2 are kept in the solver context for
+ * rerank_solve().
+ *
+ * If no organization qualifies, CACTI exits unless exit_on_error is false,
+ * in which case fin_res->valid stays false and false is returned.
  */
-void solve(uca_org_t *fin_res)
+bool solve(uca_org_t *fin_res, bool exit_on_error)
 {
   ///bool   is_dram  = false;
   int    pure_ram = g_ip->pure_ram;
@@ -841,32 +1379,16 @@ void solve(uca_org_t *fin_res)
   init_tech_params(g_ip->F_sz_um, false);
   g_ip->print_detail_debug = 0; // ---detail outputs for debug, initiated for 3D memory
 
-  list<mem_array *> tag_arr (0);
-  list<mem_array *> data_arr(0);
-  list<mem_array *>::iterator miter;
-  list<uca_org_t> sol_list(1, uca_org_t());
-
-  fin_res->tag_array.access_time = 0;
-  fin_res->tag_array.Ndwl = 0;
-  fin_res->tag_array.Ndbl = 0;
-  fin_res->tag_array.Nspd = 0;
-  fin_res->tag_array.deg_bl_muxing = 0;
-  fin_res->tag_array.Ndsam_lev_1 = 0;
-  fin_res->tag_array.Ndsam_lev_2 = 0;
+  delete g_ctx->last_solve;
+  g_ctx->last_solve = NULL;
+  solve_candidates * cand = new solve_candidates();
+  cand->input_key = PartitionMemo::input_key(*g_ip);
 
-
-  // distribute calculate_time() execution to multiple threads
-  calc_time_mt_wrapper_struct * calc_array = new calc_time_mt_wrapper_struct[nthreads];
-  pthread_t threads[nthreads];
-
-  for (uint32_t t = 0; t < nthreads; t++)
-  {
-    calc_array[t].tid         = t;
-    calc_array[t].pure_ram    = pure_ram;
-    calc_array[t].pure_cam    = pure_cam;
-    calc_array[t].data_res    = new min_values_t();
-    calc_array[t].tag_res     = new min_values_t();
-  }
+  calc_time_mt_wrapper_struct sweep;
+  vector<mem_array_rank>      rank;
+  sweep.pure_ram = pure_ram;
+  sweep.pure_cam = pure_cam;
+  sweep.prune    = partition_pruning;
 
   bool     is_tag;
   ///uint32_t ram_cell_tech_type;
@@ -874,30 +1396,18 @@ void solve(uca_org_t *fin_res)
   // If it's a cache, first calculate the area, delay and power for all tag array partitions.
   if (!(pure_ram||pure_cam||g_ip->fully_assoc))
   { //cache
+    ProfilePhase prof(PROF_TAG_SWEEP);
     is_tag              = true;
    /// ram_cell_tech_type  = g_ip->tag_arr_ram_cell_tech_type;
   ///  is_dram             = ((ram_cell_tech_type == lp_dram) || (ram_cell_tech_type == comm_dram));
     init_tech_params(g_ip->F_sz_um, is_tag);
 
-    for (uint32_t t = 0; t < nthreads; t++)
-    {
-      calc_array[t].is_tag      = is_tag;
-      calc_array[t].is_main_mem = false;
-      calc_array[t].Nspd_min    = 0.125;
-      pthread_create(&threads[t], NULL, calc_time_mt_wrapper, (void *)(&(calc_array[t])));
-    }
-
-    for (uint32_t t = 0; t < nthreads; t++)
-    {
-      pthread_join(threads[t], NULL);
-    }
-
-    for (uint32_t t = 0; t < nthreads; t++)
+    init_partition_sweep(sweep, is_tag, false, 0.125);
+    run_partition_sweep(sweep, rank, &cand->t_min);
+    for (uint32_t i = 0; i < rank.size(); i++)
     {
-      calc_array[t].data_arr.sort(mem_array::lt);
-      data_arr.merge(calc_array[t].data_arr, mem_array::lt);
-      calc_array[t].tag_arr.sort(mem_array::lt);
-      tag_arr.merge(calc_array[t].tag_arr, mem_array::lt);
+      cand->tag_arr.push_back(new mem_array());
+      rank[i].get_detail(*cand->tag_arr.back());
     }
   }
 
@@ -905,137 +1415,63 @@ void solve(uca_org_t *fin_res)
   // calculate the area, delay and power for all data array partitions (for cache or plain RAM).
 //  if (!g_ip->fully_assoc)
 // {//in the new cacti, cam, fully_associative cache are processed as single array in the data portion
+    ProfilePhase prof(PROF_DATA_SWEEP);
     is_tag              = false;
    /// ram_cell_tech_type  = g_ip->data_arr_ram_cell_tech_type;
    /// is_dram             = ((ram_cell_tech_type == lp_dram) || (ram_cell_tech_type == comm_dram));
     init_tech_params(g_ip->F_sz_um, is_tag);
 
-    for (uint32_t t = 0; t < nthreads; t++)
+    if (!(pure_cam||g_ip->fully_assoc))
     {
-      calc_array[t].is_tag      = is_tag;
-      calc_array[t].is_main_mem = g_ip->is_main_mem;
-      if (!(pure_cam||g_ip->fully_assoc))
-      {
-    	  calc_array[t].Nspd_min    = (double)(g_ip->out_w)/(double)(g_ip->block_sz*8);
-      }
-      else
-      {
-    	  calc_array[t].Nspd_min    = 1;
-      }
-
-      pthread_create(&threads[t], NULL, calc_time_mt_wrapper, (void *)(&(calc_array[t])));
+      init_partition_sweep(sweep, is_tag, g_ip->is_main_mem,
+          (double)(g_ip->out_w)/(double)(g_ip->block_sz*8));
     }
-
-    for (uint32_t t = 0; t < nthreads; t++)
-    {
-      pthread_join(threads[t], NULL);
-    }
-
-    data_arr.clear();
-    for (uint32_t t = 0; t < nthreads; t++)
+    else
     {
-      calc_array[t].data_arr.sort(mem_array::lt);
-      data_arr.merge(calc_array[t].data_arr, mem_array::lt);
+      init_partition_sweep(sweep, is_tag, g_ip->is_main_mem, 1);
     }
+    run_partition_sweep(sweep, rank, &cand->d_min);
 //  }
 
 
-  min_values_t * d_min = new min_values_t();
-  min_values_t * t_min = new min_values_t();
-  min_values_t * cache_min = new min_values_t();
-
-  for (uint32_t t = 0; t < nthreads; t++)
-  {
-    d_min->update_min_values(calc_array[t].data_res);
-    t_min->update_min_values(calc_array[t].tag_res);
-  }
-
-  for (miter = data_arr.begin(); miter != data_arr.end(); miter++)
-  {
-    (*miter)->arr_min = d_min;
-  }
-
-
-  //cout << data_arr.size() << "\t" << tag_arr.size() <<" before\n";
-  filter_data_arr(data_arr);
-  if(!(pure_ram||pure_cam||g_ip->fully_assoc))
+  //cout << rank.size() << "\t" << cand->tag_arr.size() <<" before\n";
+  bool found = filter_data_arr(rank, &cand->d_min, cand->data_arr);
+  Profiler::count(PROF_DATA_FILTERED, rank.size() - cand->data_arr.size());
+  release_partition_sweep(sweep);
+  if (!found)
   {
-    filter_tag_arr(t_min, tag_arr);
+    if (exit_on_error) exit(1);
+    delete cand;
+    fin_res->valid = false;
+    return false;
   }
-  //cout << data_arr.size() << "\t" << tag_arr.size() <<" after\n";
-
 
-  if (pure_ram||pure_cam||g_ip->fully_assoc)
+  if (ParetoFront::enabled() &&
+      (pure_ram || pure_cam || g_ip->fully_assoc || !cand->tag_arr.empty()))
   {
-    for (miter = data_arr.begin(); miter != data_arr.end(); miter++)
-    {
-      uca_org_t & curr_org  = sol_list.back();
-      curr_org.tag_array2  = NULL;
-      curr_org.data_array2 = (*miter);
-
-      curr_org.find_delay();
-      curr_org.find_energy();
-      curr_org.find_area();
-      curr_org.find_cyc();
-
-      //update min values for the entire cache
-      cache_min->update_min_values(curr_org);
-
-      sol_list.push_back(uca_org_t());
-    }
+    write_pareto_front(*cand);
   }
-  else
-  {
-    while (tag_arr.empty() != true)
-    {
-      mem_array * arr_temp = (tag_arr.back());
-      //delete tag_arr.back();
-      tag_arr.pop_back();
 
-      for (miter = data_arr.begin(); miter != data_arr.end(); miter++)
-      {
-        uca_org_t & curr_org  = sol_list.back();
-        curr_org.tag_array2  = arr_temp;
-        curr_org.data_array2 = (*miter);
-
-        curr_org.find_delay();
-        curr_org.find_energy();
-        curr_org.find_area();
-        curr_org.find_cyc();
-
-        //update min values for the entire cache
-        cache_min->update_min_values(curr_org);
-
-        sol_list.push_back(uca_org_t());
-      }
-    }
-  }
-
-  sol_list.pop_back();
+  g_ctx->last_solve = cand;
+  return rank_candidates(*cand, fin_res, exit_on_error);
+}
 
-  find_optimal_uca(fin_res, cache_min, sol_list);
 
-  sol_list.clear();
 
-  for (miter = data_arr.begin(); miter != data_arr.end(); ++miter)
-  {
-    if (*miter != fin_res->data_array2)
-    {
-      delete *miter;
-    }
-  }
-  data_arr.clear();
+// Pick the organization of the last solve() on this context again, for the
+// current weights, deviation limits and ed. False, with fin_res->valid
+// false, if every other input is not the same as in that solve.
+bool rerank_solve(uca_org_t *fin_res)
+{
+  solve_candidates * cand = g_ctx->last_solve;
 
-  for (uint32_t t = 0; t < nthreads; t++)
+  if (cand == NULL || cand->input_key != PartitionMemo::input_key(*g_ip))
   {
-    delete calc_array[t].data_res;
-    delete calc_array[t].tag_res;
+    cout << "ERROR: no earlier solve with the same inputs to rerank" << endl;
+    fin_res->valid = false;
+    return false;
   }
-
-  delete [] calc_array;
-  delete cache_min;
-  delete d_min;
-  delete t_min;
+  return rank_candidates(*cand, fin_res, false);
 }
 
 void update(uca_org_t *fin_res)
@@ -1071,3 +1507,109 @@ void update(uca_org_t *fin_res)
   fin_res->find_energy();
 }
 
+
+
+// One temperature sweep. The array geometries do not depend on the
+// temperature, so they are worked out once and shared by every point.
+struct temp_sweep_struct
+{
+  const InputParameter   * ip;
+  const DynamicParameter * tag_dyn_p;  // NULL without a tag array
+  const DynamicParameter * data_dyn_p;
+  const vector<unsigned int> * points;
+  vector<uca_temp_power_t>   * res;
+};
+
+// Builds the arrays at points[idx], the way update() would, in a context
+// of its own; the tech and wire tables at that temperature come from their
+// caches once any solve has loaded them.
+static void sweep_temperature_point(void * void_obj, uint64_t idx, uint32_t)
+{
+  temp_sweep_struct & sw = *(temp_sweep_struct *) void_obj;
+  uca_temp_power_t & r = (*sw.res)[idx];
+  InputParameter ip(*sw.ip);
+  ip.temp = (*sw.points)[idx];
+  r.temp  = ip.temp;
+
+  SolverContext ctx(&ip);
+  SolverContext * prev = ctx.bind();
+  init_tech_params(g_ip->F_sz_um, false);
+  Wire winit; // Do not delete this line. It initializes wires.
+  {
+    ArenaScope scope;
+    if (sw.tag_dyn_p)
+    {
+      init_tech_params(g_ip->F_sz_um, true);
+      UCA * tag_arr = new UCA(*sw.tag_dyn_p);
+      r.tag_power = tag_arr->power;
+      delete tag_arr;
+      init_tech_params(g_ip->F_sz_um, false);
+    }
+    UCA * data_arr = new UCA(*sw.data_dyn_p);
+    r.data_power = data_arr->power;
+    delete data_arr;
+  }
+  r.power = (sw.tag_dyn_p) ? r.data_power + r.tag_power : r.data_power;
+  prev->bind();
+}
+
+
+
+// Only the leakage currents of the devices depend on the temperature, and
+// the tech files tabulate them every 10K. The geometry of the tag and data
+// arrays is set up once; then all distinct temperatures of temps are
+// evaluated in a single parallel pass, each in its own context, so g_ip,
+// g_tp and the wire tables of the caller are never touched.
+bool sweep_temperature(const uca_org_t & fin_res, const vector<unsigned int> & temps, vector<uca_temp_power_t> & res)
+{
+  const mem_array * tag  = fin_res.tag_array2;
+  const mem_array * data = fin_res.data_array2;
+  vector<unsigned int> points(temps);
+
+  for (uint32_t i = 0; i < temps.size(); i++)
+  {
+    if (temps[i] < 300 || temps[i] > 400 || temps[i] % 10 != 0)
+    {
+      cerr << temps[i] << " Temperature must be between 300 and 400 Kelvin and multiple of 10." << endl;
+      return false;
+    }
+  }
+  sort(points.begin(), points.end());
+  points.erase(unique(points.begin(), points.end()), points.end());
+
+  // a scratch context, as the geometry needs the tag and the data tech tables
+  InputParameter ip(*g_ip);
+  SolverContext geo_ctx(&ip);
+  SolverContext * prev = geo_ctx.bind();
+  DynamicParameter tag_dyn_p;
+  if (tag)
+  {
+    init_tech_params(g_ip->F_sz_um, true);
+    tag_dyn_p = DynamicParameter(true, g_ip->pure_ram, g_ip->pure_cam, tag->Nspd, tag->Ndwl, tag->Ndbl, tag->Ndcm, tag->Ndsam_lev_1, tag->Ndsam_lev_2, data->wt, g_ip->is_main_mem);
+  }
+  init_tech_params(g_ip->F_sz_um, false);
+  DynamicParameter data_dyn_p(false, g_ip->pure_ram, g_ip->pure_cam, data->Nspd, data->Ndwl, data->Ndbl, data->Ndcm, data->Ndsam_lev_1, data->Ndsam_lev_2, data->wt, g_ip->is_main_mem);
+  prev->bind();
+  if (!data_dyn_p.is_valid || (tag && !tag_dyn_p.is_valid))
+  {
+    cout << "ERROR: Cannot retrieve array structure for leakage feedback" << endl;
+    return false;
+  }
+
+  vector<uca_temp_power_t> point_res(points.size());
+  temp_sweep_struct sw;
+  sw.ip         = &ip;
+  sw.tag_dyn_p  = (tag) ? &tag_dyn_p : NULL;
+  sw.data_dyn_p = &data_dyn_p;
+  sw.points     = &points;
+  sw.res        = &point_res;
+  ThreadPool::instance().parallel_for(points.size(), sweep_temperature_point, (void *) &sw);
+
+  res.resize(temps.size());
+  for (uint32_t i = 0; i < temps.size(); i++)
+  {
+    res[i] = point_res[lower_bound(points.begin(), points.end(), temps[i]) - points.begin()];
+  }
+  return true;
+}
+
@@ -34,6 +34,7 @@
 #define __UCACHE_H__
 
 #include <list>
+#include <vector>
 #include "area.h"
 #include "router.h"
 #include "nuca.h"
@@ -58,6 +59,27 @@ class min_values_t
 
 
 
+// Valid tag arrays and filtered data arrays of a solve(), which is all the
+// ranking needs; input_key is PartitionMemo::input_key() of its inputs.
+class solve_candidates
+{
+  public:
+    uint64_t          input_key;
+    list<mem_array *> tag_arr;
+    list<mem_array *> data_arr;
+    min_values_t      t_min;
+    min_values_t      d_min;
+
+    solve_candidates() : input_key(0) { }
+    ~solve_candidates();
+
+  private:
+    solve_candidates(const solve_candidates &);
+    solve_candidates & operator=(const solve_candidates &);
+};
+
+
+
 struct solution
 {
   int    tag_array_index;
@@ -88,30 +110,123 @@ bool calculate_time(
     results_mem_array *ptr_results,
     uca_org_t *ptr_fin_res,
     Wire_type wtype, // merge from cacti-7 to cacti3d
-    bool is_main_mem);
+    bool is_main_mem,
+    const min_values_t * prune_min = NULL,
+    bool * built = NULL);  // set if the partition got as far as building its arrays
 void update(uca_org_t *fin_res);
-
-void solve(uca_org_t *fin_res);
+// See temperature_sweep() in cacti_interface.h; works on g_ip.
+bool sweep_temperature(const uca_org_t & fin_res, const vector<unsigned int> & temps, vector<uca_temp_power_t> & res);
+
+bool solve(uca_org_t *fin_res, bool exit_on_error = true);
+// Rank the candidates of the last solve() on this context again for the
+// current objective weights, deviation limits and ed.
+bool rerank_solve(uca_org_t *fin_res);
+// Skip data array partitions whose lower bounds show they cannot be chosen.
+// Off by default; the chosen organization is the same either way.
+void set_partition_pruning(bool on);
 void init_tech_params(double tech, bool is_tag);
 
 
+// Ranking view of a valid partition: the fields ordering and filtering the
+// sweep results read, kept apart from the full record so passes over all
+// candidates touch a few cache lines each.
+struct mem_array_rank
+{
+  // mem_array::lt key
+  double   Nspd;
+  int      Ndwl;
+  int      Ndbl;
+  int      deg_bl_muxing;
+  int      Ndsam_lev_1;
+  int      Ndsam_lev_2;
+
+  double   access_time;
+  double   cycle_time;
+  double   dyn;
+  double   leakage;
+  double   area;
+
+  uint64_t         idx;     // candidate index in the sweep
+  uint64_t         pos;     // offset of the packed record in its slot
+  const uint64_t * detail;  // packed record (mem_array::pack), owned by the sweep slot
+
+  mem_array_rank(uint64_t idx, uint64_t pos, const mem_array & m);
+
+  void get_detail(mem_array & m) const { mem_array::unpack(detail, m); }
+
+  // mem_array::lt, ties broken by candidate index
+  static bool lt(const mem_array_rank & r1, const mem_array_rank & r2);
+};
+
+// per-slot output of a partition sweep
+struct calc_time_slot
+{
+  min_values_t min_res;
+  mem_array *  spare;
+  uint64_t     evaluated;  // candidates whose arrays the slot built
+  vector<uint64_t>       packed;  // valid partitions found by the slot, packed
+  vector<mem_array_rank> rank;    // their ranking view, detail set once the sweep is done
+
+  calc_time_slot() : spare(NULL), evaluated(0) { }
+};
+
 struct calc_time_mt_wrapper_struct
 {
-  uint32_t tid;
   bool     is_tag;
   bool     pure_ram;
   bool     pure_cam;
   bool     is_main_mem;
-  double   Nspd_min;
+  bool     prune;  // skip data partitions that cannot survive filter_data_arr()
+
+  // candidate space: Nspd x wire type x (Ndwl, Ndbl, Ndcm) x (Ndsam_lev_1, Ndsam_lev_2)
+  vector<double>       Nspd;
+  vector<int>          wt;
+  vector<unsigned int> Ndwl;
+  vector<unsigned int> Ndbl;
+  vector<unsigned int> Ndcm;
+  vector<unsigned int> Ndsam_lev_1;
+  vector<unsigned int> Ndsam_lev_2;
+
+  vector<calc_time_slot> slot;
+};
+
+// metrics of one tag x data organization, as find_optimal_uca() ranks them
+struct uca_org_cost
+{
+  double access_time;
+  double cycle_time;
+  double dyn;
+  double leakage;
+  double area;
+
+  // no worse in any metric
+  bool dominates(const uca_org_cost & c) const
+  {
+    return access_time <= c.access_time && cycle_time <= c.cycle_time &&
+           dyn <= c.dyn && leakage <= c.leakage && area <= c.area;
+  }
+};
 
-  min_values_t * data_res;
-  min_values_t * tag_res;
+// tag x data combination step of solve(); organization i pairs
+// tag[i / data.size()] with data[i % data.size()]
+struct uca_combine_struct
+{
+  vector<mem_array *> tag;   // a single NULL without a tag array
+  vector<mem_array *> data;
+  bool                prune_dominated;
 
-  list<mem_array *> data_arr;
-  list<mem_array *> tag_arr;
+  vector<vector<uint32_t> > kept;     // per chunk: organizations left after filtering
+  vector<vector<uca_org_cost> > cost;  // and their metrics
+  vector<min_values_t>          min_res;
 };
 
-void *calc_time_mt_wrapper(void * void_obj);
+void combine_tag_data(uca_combine_struct & comb, min_values_t * min_res, list<uca_org_t> & ulist);
+
+void init_partition_sweep(calc_time_mt_wrapper_struct & sweep, bool is_tag, bool is_main_mem, double Nspd_min);
+uint64_t partition_sweep_size(const calc_time_mt_wrapper_struct & sweep);
+void calc_time_mt_wrapper(void * void_obj, uint64_t idx, uint32_t slot);
+void run_partition_sweep(calc_time_mt_wrapper_struct & sweep, vector<mem_array_rank> & arr, min_values_t * min_res);
+void release_partition_sweep(calc_time_mt_wrapper_struct & sweep);
 
 void print_g_tp();
 
@@ -0,0 +1,315 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+// Checks of the library interface (make api_test) that the golden-output
+// regression cannot make, as they need several solves of one config in a
+// process. Run from this directory; tech files are read relative to it.
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cacti_interface.h"
+#include "parameter.h"
+#include "pareto.h"
+
+using namespace std;
+
+
+static int failures = 0;
+
+static void check(bool ok, const string & what)
+{
+  if (!ok)
+  {
+    cout << "FAIL: " << what << endl;
+    failures++;
+  }
+}
+
+
+
+static void set_weights(InputParameter & ip, int delay, int dyn, int leakage, int cycle, int area)
+{
+  ip.delay_wt         = delay;
+  ip.dynamic_power_wt = dyn;
+  ip.leakage_power_wt = leakage;
+  ip.cycle_time_wt    = cycle;
+  ip.area_wt          = area;
+}
+
+
+
+static string read_file(const char * name)
+{
+  ifstream file(name);
+  ostringstream text;
+  text << file.rdbuf();
+  return text.str();
+}
+
+
+
+static void print_org(ostream & os, const mem_array * m)
+{
+  os << m->Ndwl << ", " << m->Ndbl << ", " << m->Nspd << ", " << m->deg_bl_muxing << ", "
+     << m->Ndsam_lev_1 << ", " << m->Ndsam_lev_2 << ", ";
+}
+
+
+
+// Whether front, as ParetoFront writes it, has a row for the organization
+// of r with its metrics; wire types are not compared.
+static bool on_front(const string & front, const uca_org_t & r)
+{
+  ostringstream metrics, data, tag;
+  metrics << ", " << r.access_time*1e+9 << ", " << r.cycle_time*1e+9 << ", "
+          << r.power.readOp.dynamic*1e+9 << ", " << r.power.readOp.leakage*1e+3 << ", "
+          << r.area*1e-6 << ", ";
+  data << "N/A, N/A, N/A, N/A, ";
+  print_org(data, r.data_array2);
+  if (r.tag_array2 != NULL)
+  {
+    print_org(tag, r.tag_array2);
+  }
+
+  istringstream rows(front);
+  string row;
+  while (getline(rows, row))
+  {
+    size_t d = row.find(data.str());
+    if (row.find(metrics.str()) != string::npos && d != string::npos &&
+        row.find(tag.str(), d + data.str().size()) != string::npos)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+
+static bool same_org(const mem_array * a, const mem_array * b)
+{
+  if (a == NULL || b == NULL)
+  {
+    return a == b;
+  }
+  return a->Ndwl == b->Ndwl && a->Ndbl == b->Ndbl && a->Nspd == b->Nspd &&
+         a->deg_bl_muxing == b->deg_bl_muxing && a->Ndsam_lev_1 == b->Ndsam_lev_1 &&
+         a->Ndsam_lev_2 == b->Ndsam_lev_2 && a->wt == b->wt;
+}
+
+
+
+// Re-ranking the last solve after a change of weights or deviation limits
+// only picks what a full solve with them picks, and refuses other changes.
+static void test_rerank()
+{
+  // delay, dynamic, leakage, cycle and area weights, then deviation limits
+  const int objectives[][10] = {
+    { 0, 0, 0, 0, 0, 30, 100000, 100000, 100000, 1000000 },
+    { 100, 10, 10, 10, 10, 60, 100000, 100000, 100000, 1000000 },
+    { 10, 10, 100, 10, 10, 100000, 100000, 100000, 100000, 1000000 },
+    { 10, 100, 10, 10, 100, 50, 100000, 100000, 100000, 100000 },
+    { 1, 1, 1, 1, 1, 1000, 1000, 1000, 1000, 1000 } };
+  const uint32_t n = sizeof(objectives)/sizeof(objectives[0]);
+  const char * configs[] = { "test_configs/cache1.cfg", "test_configs/ram4.cfg" };
+  for (uint32_t c = 0; c < sizeof(configs)/sizeof(configs[0]); c++)
+  {
+    InputParameter ip;
+    ip.parse_cfg(configs[c]);
+    uca_org_t first = cacti_interface(&ip);
+    check(first.valid, string(configs[c]) + " solve");
+    first.cleanup();
+
+    // every rerank works on the candidates of the first solve
+    vector<InputParameter> ips(n, ip);
+    vector<uca_org_t> reranked(n);
+    for (uint32_t w = 0; w < n; w++)
+    {
+      const int * o = objectives[w];
+      if (o[0] != 0)
+      {
+        set_weights(ips[w], o[0], o[1], o[2], o[3], o[4]);
+      }
+      ips[w].delay_dev         = o[5];
+      ips[w].dynamic_power_dev = o[6];
+      ips[w].leakage_power_dev = o[7];
+      ips[w].cycle_time_dev    = o[8];
+      ips[w].area_dev          = o[9];
+      reranked[w] = rerank_interface(&ips[w]);
+    }
+
+    for (uint32_t w = 0; w < n; w++)
+    {
+      ostringstream what;
+      what << configs[c] << " objective " << w;
+      InputParameter ip2(ips[w]);
+      uca_org_t full = cacti_interface(&ip2);
+      uca_org_t & r  = reranked[w];
+      check(r.valid && full.valid, what.str() + " rerank");
+      if (r.valid && full.valid)
+      {
+        check(r.access_time == full.access_time && r.cycle_time == full.cycle_time &&
+              r.area == full.area && r.power.readOp.dynamic == full.power.readOp.dynamic &&
+              r.power.readOp.leakage == full.power.readOp.leakage,
+              what.str() + " metrics differ from a full solve");
+        check(same_org(r.data_array2, full.data_array2) && same_org(r.tag_array2, full.tag_array2),
+              what.str() + " organization differs from a full solve");
+      }
+      r.cleanup();
+      full.cleanup();
+    }
+
+    InputParameter other(ip);
+    other.cache_sz *= 2;
+    uca_org_t r = rerank_interface(&other);
+    check(!r.valid, string(configs[c]) + " rerank accepts another size");
+  }
+}
+
+
+
+static bool same_power(const powerDef & a, const powerDef & b)
+{
+  return a.readOp.dynamic == b.readOp.dynamic && a.readOp.leakage == b.readOp.leakage &&
+         a.readOp.gate_leakage == b.readOp.gate_leakage &&
+         a.writeOp.dynamic == b.writeOp.dynamic && a.searchOp.dynamic == b.searchOp.dynamic;
+}
+
+
+
+// A temperature sweep of a solved organization gives at every temperature
+// what reconfigure() gives for that temperature, and leaves its inputs as
+// they were.
+static void test_temperature_sweep()
+{
+  const char * configs[] = { "test_configs/cache1.cfg", "test_configs/ram4.cfg" };
+  const unsigned int temps[] = { 350, 300, 400, 350 };
+  for (uint32_t c = 0; c < sizeof(configs)/sizeof(configs[0]); c++)
+  {
+    InputParameter ip;
+    ip.parse_cfg(configs[c]);
+    uca_org_t r = cacti_interface(&ip);
+    check(r.valid, string(configs[c]) + " solve");
+    if (!r.valid)
+    {
+      continue;
+    }
+
+    unsigned int temp0 = ip.temp;
+    powerDef power0 = r.power;
+    vector<unsigned int> t(temps, temps + sizeof(temps)/sizeof(temps[0]));
+    vector<uca_temp_power_t> res;
+    check(temperature_sweep(&ip, r, t, res) && res.size() == t.size(),
+          string(configs[c]) + " sweep");
+    check(ip.temp == temp0 && same_power(r.power, power0),
+          string(configs[c]) + " sweep changed its inputs");
+
+    for (uint32_t i = 0; i < res.size(); i++)
+    {
+      ostringstream what;
+      what << configs[c] << " at " << t[i] << "K";
+      InputParameter ip2(ip);
+      ip2.temp = t[i];
+      reconfigure(&ip2, &r);
+      check(res[i].temp == t[i], what.str() + " temperature");
+      check(same_power(res[i].power, r.power), what.str() + " power differs from reconfigure()");
+      check(same_power(res[i].data_power, r.data_array2->power), what.str() + " data array power");
+      check(r.tag_array2 == NULL || same_power(res[i].tag_power, r.tag_array2->power),
+            what.str() + " tag array power");
+    }
+    check(res[0].power.readOp.leakage < res[2].power.readOp.leakage,
+          string(configs[c]) + " leakage does not grow with the temperature");
+
+    t.push_back(305);
+    check(!temperature_sweep(&ip, r, t, res), string(configs[c]) + " sweep accepts 305K");
+    r.cleanup();
+  }
+}
+
+
+
+// The front a solve writes does not depend on the weights, and holds the
+// organization the solve picks under any of them.
+static void test_pareto_front()
+{
+  const char * file = "api_test.pareto.csv";
+  const int    weights[][5] = { { 100, 10, 10, 10, 10 }, { 10, 10, 100, 10, 10 },
+                                { 10, 100, 10, 10, 100 }, { 1, 1, 1, 1, 1 } };
+  const char * configs[] = { "test_configs/cache1.cfg", "test_configs/ram4.cfg" };
+  for (uint32_t c = 0; c < sizeof(configs)/sizeof(configs[0]); c++)
+  {
+    InputParameter ip;
+    ip.parse_cfg(configs[c]);
+    string first;
+    for (uint32_t w = 0; w < sizeof(weights)/sizeof(weights[0]); w++)
+    {
+      set_weights(ip, weights[w][0], weights[w][1], weights[w][2], weights[w][3], weights[w][4]);
+      ParetoFront::set_file(file);
+      uca_org_t r = cacti_interface(&ip);
+      string front = read_file(file);
+      ostringstream what;
+      what << configs[c] << " weights " << weights[w][0] << ":" << weights[w][1] << ":"
+           << weights[w][2] << ":" << weights[w][3] << ":" << weights[w][4];
+
+      check(r.valid, what.str() + " solve");
+      if (w == 0)
+      {
+        first = front;
+      }
+      check(front == first, what.str() + " front differs from the first weights'");
+      check(r.valid && on_front(front, r), what.str() + " optimum is not on the front");
+      r.cleanup();
+    }
+  }
+  remove(file);
+}
+
+
+
+int main()
+{
+  test_rerank();
+  test_temperature_sweep();
+  test_pareto_front();
+
+  cout << (failures ? "FAIL" : "ok") << ", " << failures << " failures" << endl;
+  return failures ? 1 : 0;
+}
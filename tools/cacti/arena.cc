@@ -0,0 +1,132 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#include <stdlib.h>
+#include <iostream>
+
+#include "arena.h"
+
+using namespace std;
+
+#define ARENA_BLOCK_SIZE (256 * 1024)
+#define ARENA_ALIGN      16
+
+
+// The arena of a pool thread is kept for the life of the thread.
+static __thread Arena * t_arena = NULL;
+static __thread int     t_depth = 0;
+
+
+
+Arena::Arena()
+  : blocks(), cur(0), used(0)
+{
+}
+
+
+
+Arena::~Arena()
+{
+  for (size_t i = 0; i < blocks.size(); i++)
+  {
+    free(blocks[i].base);
+  }
+}
+
+
+
+void * Arena::alloc(size_t size)
+{
+  size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+  while (cur < blocks.size() && used + size > blocks[cur].size)
+  {
+    cur++;
+    used = 0;
+  }
+
+  if (cur == blocks.size())
+  {
+    Block b;
+    b.size = (size > ARENA_BLOCK_SIZE) ? size : ARENA_BLOCK_SIZE;
+    b.base = (char *) malloc(b.size);
+    if (b.base == NULL)
+    {
+      cerr << "ERROR: out of memory in component arena" << endl;
+      exit(1);
+    }
+    blocks.push_back(b);
+    used = 0;
+  }
+
+  void * p = blocks[cur].base + used;
+  used += size;
+  return p;
+}
+
+
+
+void Arena::reset()
+{
+  cur  = 0;
+  used = 0;
+}
+
+
+
+Arena * Arena::active()
+{
+  return (t_depth > 0) ? t_arena : NULL;
+}
+
+
+
+ArenaScope::ArenaScope()
+{
+  if (t_arena == NULL)
+  {
+    t_arena = new Arena();
+  }
+  t_depth++;
+}
+
+
+
+ArenaScope::~ArenaScope()
+{
+  if (--t_depth == 0)
+  {
+    t_arena->reset();
+  }
+}
@@ -0,0 +1,89 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stddef.h>
+#include <vector>
+
+using namespace std;
+
+
+// Bump allocator for the component tree (UCA, Bank, Mat, Decoder, Htree2,
+// Wire, ...) built for one sweep candidate. Component::operator new takes
+// memory from the calling thread's arena while an ArenaScope is open on that
+// thread; deleting such a component is free and the memory is handed back
+// all at once when the outermost scope closes.
+class Arena
+{
+  public:
+    Arena();
+    ~Arena();
+
+    void * alloc(size_t size);
+    void   reset();
+
+    // arena of the calling thread if an ArenaScope is open on it, else NULL
+    static Arena * active();
+
+  private:
+    struct Block
+    {
+      char * base;
+      size_t size;
+    };
+
+    vector<Block> blocks;
+    size_t        cur;   // block being filled
+    size_t        used;  // bytes used in blocks[cur]
+
+    Arena(const Arena &);
+    Arena & operator=(const Arena &);
+
+    friend class ArenaScope;
+};
+
+
+
+// Components allocated on this thread while a scope is open live in the
+// thread's arena, so they must not outlive the scope.
+class ArenaScope
+{
+  public:
+    ArenaScope();
+    ~ArenaScope();
+};
+
+#endif
@@ -58,6 +58,19 @@ uint32_t _log2(uint64_t num)
 }
 
 
+uint64_t hash_bytes(const void * data, size_t len, uint64_t h)
+{
+  const unsigned char * p = (const unsigned char *) data;
+
+  for (size_t i = 0; i < len; i++)
+  {
+    h ^= p[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+
 bool is_pow2(int64_t val)
 {
   if (val <= 0)
@@ -170,40 +183,16 @@ double gate_C_pass(
 
 
 
-double drain_C_(
+// drain capacitance of a transistor of device type dt
+static double drain_C_of(
+    const DeviceType * dt,
     double width,
     int nchannel,
     int stack,
     int next_arg_thresh_folding_width_or_height_cell,
-    double fold_dimension,
-    bool _is_dram,
-    bool _is_cell,
-    bool _is_wl_tr,
-    bool _is_sleep_tx)
+    double fold_dimension)
 {
   double w_folded_tr;
-  const  /*TechnologyParameter::*/DeviceType * dt;
-
-  if ((_is_dram) && (_is_cell))
-  {
-    dt = &g_tp.dram_acc;   // DRAM cell access transistor
-  }
-  else if ((_is_dram) && (_is_wl_tr))
-  {
-    dt = &g_tp.dram_wl;    // DRAM wordline transistor
-  }
-  else if ((!_is_dram) && _is_cell)
-  {
-    dt = &g_tp.sram_cell;  // SRAM cell access transistor
-  }
-  else if (_is_sleep_tx)
-  {
-    dt = &g_tp.sleep_tx;  // Sleep transistor
-  }
-  else
-  {
-    dt = &g_tp.peri_global;
-  }
 
   double c_junc_area = dt->C_junc;
   double c_junc_sidewall = dt->C_junc_sidewall;
@@ -263,6 +252,44 @@ double drain_C_(
 }
 
 
+double drain_C_(
+    double width,
+    int nchannel,
+    int stack,
+    int next_arg_thresh_folding_width_or_height_cell,
+    double fold_dimension,
+    bool _is_dram,
+    bool _is_cell,
+    bool _is_wl_tr,
+    bool _is_sleep_tx)
+{
+  const  /*TechnologyParameter::*/DeviceType * dt;
+
+  if ((_is_dram) && (_is_cell))
+  {
+    dt = &g_tp.dram_acc;   // DRAM cell access transistor
+  }
+  else if ((_is_dram) && (_is_wl_tr))
+  {
+    dt = &g_tp.dram_wl;    // DRAM wordline transistor
+  }
+  else if ((!_is_dram) && _is_cell)
+  {
+    dt = &g_tp.sram_cell;  // SRAM cell access transistor
+  }
+  else if (_is_sleep_tx)
+  {
+    dt = &g_tp.sleep_tx;  // Sleep transistor
+  }
+  else
+  {
+    dt = &g_tp.peri_global;
+  }
+
+  return drain_C_of(dt, width, nchannel, stack, next_arg_thresh_folding_width_or_height_cell, fold_dimension);
+}
+
+
 double tr_R_on(
     double width,
     int nchannel,
@@ -604,20 +631,14 @@ double cmos_Ig_p(
   return pWidth*dt->I_g_on_p;
 }
 
-double cmos_Isub_leakage(
-    double nWidth,
-    double pWidth,
+// subthreshold leakage of a gate whose transistors leak nmos_leak/pmos_leak
+static double Isub_of(
+    double nmos_leak,
+    double pmos_leak,
     int    fanin,
     enum Gate_type g_type,
-    bool _is_dram,
-    bool _is_cell,
-    bool _is_wl_tr,
-    bool _is_sleep_tx,
     enum Half_net_topology topo)
 {
-	assert (fanin>=1);
-	double nmos_leak = simplified_nmos_leakage(nWidth, _is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
-	double pmos_leak = simplified_pmos_leakage(pWidth, _is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
     double Isub=0;
     int    num_states;
     int    num_off_tx;
@@ -709,8 +730,7 @@ double cmos_Isub_leakage(
     return Isub;
 }
 
-
-double cmos_Ig_leakage(
+double cmos_Isub_leakage(
     double nWidth,
     double pWidth,
     int    fanin,
@@ -722,8 +742,20 @@ double cmos_Ig_leakage(
     enum Half_net_topology topo)
 {
 	assert (fanin>=1);
-		double nmos_leak = cmos_Ig_n(nWidth, _is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
-		double pmos_leak = cmos_Ig_p(pWidth, _is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+	double nmos_leak = simplified_nmos_leakage(nWidth, _is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+	double pmos_leak = simplified_pmos_leakage(pWidth, _is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+	return Isub_of(nmos_leak, pmos_leak, fanin, g_type, topo);
+}
+
+
+// gate leakage of a gate whose transistors leak nmos_leak/pmos_leak
+static double Ig_of(
+    double nmos_leak,
+    double pmos_leak,
+    int    fanin,
+    enum Gate_type g_type,
+    enum Half_net_topology topo)
+{
 	    double Ig_on=0;
 	    int    num_states;
 	    int    num_on_tx;
@@ -835,6 +867,23 @@ double cmos_Ig_leakage(
 	    return Ig_on;
 }
 
+double cmos_Ig_leakage(
+    double nWidth,
+    double pWidth,
+    int    fanin,
+    enum Gate_type g_type,
+    bool _is_dram,
+    bool _is_cell,
+    bool _is_wl_tr,
+    bool _is_sleep_tx,
+    enum Half_net_topology topo)
+{
+	assert (fanin>=1);
+		double nmos_leak = cmos_Ig_n(nWidth, _is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+		double pmos_leak = cmos_Ig_p(pWidth, _is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+	return Ig_of(nmos_leak, pmos_leak, fanin, g_type, topo);
+}
+
 double shortcircuit_simple(
     double vt,
     double velocity_index,
@@ -997,3 +1046,206 @@ double tsv_area(double tsv_pitch)
 	return(pow(tsv_pitch,2));
 }
 // end ali
+
+
+
+/*----------------------------------------------------------------------*/
+// Batched device equations
+
+// Each helper evaluates the same expression, in the same order, as the
+// scalar function it stands in for, so the results are bit-identical.
+
+// y = a*x + b
+static void batch_mul_add(int n, const double * x, double a, double b, double * y)
+{
+  for (int i = 0; i < n; i++)
+  {
+    y[i] = a*x[i] + b;
+  }
+}
+
+// y = x*a
+static void batch_mul(int n, const double * x, double a, double * y)
+{
+  for (int i = 0; i < n; i++)
+  {
+    y[i] = x[i]*a;
+  }
+}
+
+// y = a/x
+static void batch_div(int n, double a, const double * x, double * y)
+{
+  for (int i = 0; i < n; i++)
+  {
+    y[i] = a/x[i];
+  }
+}
+
+// y = (x + z)/2
+static void batch_half_sum(int n, const double * x, const double * z, double * y)
+{
+  for (int i = 0; i < n; i++)
+  {
+    y[i] = (x[i] + z[i])/2;
+  }
+}
+
+// device type of gate_C(), drain_C_() and tr_R_on()
+static const DeviceType * circuit_device(bool _is_dram, bool _is_cell, bool _is_wl_tr, bool _is_sleep_tx)
+{
+  if ((_is_dram) && (_is_cell))
+  {
+    return &g_tp.dram_acc;   //DRAM cell access transistor
+  }
+  else if ((_is_dram) && (_is_wl_tr))
+  {
+    return &g_tp.dram_wl;    //DRAM wordline transistor
+  }
+  else if ((!_is_dram) && _is_cell)
+  {
+    return &g_tp.sram_cell;  // SRAM cell access transistor
+  }
+  else if (_is_sleep_tx)
+  {
+    return &g_tp.sleep_tx;  // Sleep transistor
+  }
+  return &g_tp.peri_global;
+}
+
+// device type of the leakage functions
+static const DeviceType * leakage_device(bool _is_dram, bool _is_cell, bool _is_wl_tr, bool _is_sleep_tx)
+{
+  if ((!_is_dram)&&(_is_cell))
+  { //SRAM cell access transistor
+    return &(g_tp.sram_cell);
+  }
+  else if ((_is_dram)&&(_is_wl_tr))
+  { //DRAM wordline transistor
+    return &(g_tp.dram_wl);
+  }
+  else if (_is_sleep_tx)
+  {
+    return &g_tp.sleep_tx;  // Sleep transistor
+  }
+  return &(g_tp.peri_global);
+}
+
+void gate_C_batch(
+    int n,
+    const double * width,
+    double * c,
+    bool _is_dram,
+    bool _is_cell,
+    bool _is_wl_tr,
+    bool _is_sleep_tx)
+{
+  const DeviceType * dt = circuit_device(_is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+  batch_mul_add(n, width, dt->C_g_ideal + dt->C_overlap + 3*dt->C_fringe, dt->l_phy*Cpolywire, c);
+}
+
+void drain_C_batch(
+    int n,
+    const double * width,
+    int nchannel,
+    int stack,
+    int next_arg_thresh_folding_width_or_height_cell,
+    double fold_dimension,
+    double * c,
+    bool _is_dram,
+    bool _is_cell,
+    bool _is_wl_tr,
+    bool _is_sleep_tx)
+{
+  // transistor folding makes this one branchy, so it stays scalar
+  const DeviceType * dt = circuit_device(_is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+  for (int i = 0; i < n; i++)
+  {
+    c[i] = drain_C_of(dt, width[i], nchannel, stack, next_arg_thresh_folding_width_or_height_cell, fold_dimension);
+  }
+}
+
+void tr_R_on_batch(
+    int n,
+    const double * width,
+    int nchannel,
+    int stack,
+    double * r,
+    bool _is_dram,
+    bool _is_cell,
+    bool _is_wl_tr,
+    bool _is_sleep_tx)
+{
+  const DeviceType * dt = circuit_device(_is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+  double restrans = (nchannel) ? dt->R_nch_on : dt->R_pch_on;
+  batch_div(n, stack * restrans, width, r);
+}
+
+// the leakage batches work through their inputs in chunks this long
+#define LEAKAGE_CHUNK 64
+
+void cmos_Isub_leakage_batch(
+    int n,
+    const double * nWidth,
+    const double * pWidth,
+    int    fanin,
+    enum Gate_type g_type,
+    double * Isub,
+    bool _is_dram,
+    bool _is_cell,
+    bool _is_wl_tr,
+    bool _is_sleep_tx,
+    enum Half_net_topology topo)
+{
+  assert (fanin>=1);
+  const DeviceType * dt = leakage_device(_is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+  double nmos_leak[LEAKAGE_CHUNK], pmos_leak[LEAKAGE_CHUNK];
+  for (int i = 0; i < n; i += LEAKAGE_CHUNK)
+  {
+    int m = (n - i < LEAKAGE_CHUNK) ? n - i : LEAKAGE_CHUNK;
+    batch_mul(m, nWidth + i, dt->I_off_n, nmos_leak);
+    batch_mul(m, pWidth + i, dt->I_off_p, pmos_leak);
+    if (g_type == inv || g_type == tg)
+    {
+      batch_half_sum(m, nmos_leak, pmos_leak, Isub + i);
+      continue;
+    }
+    for (int j = 0; j < m; j++)
+    {
+      Isub[i + j] = Isub_of(nmos_leak[j], pmos_leak[j], fanin, g_type, topo);
+    }
+  }
+}
+
+void cmos_Ig_leakage_batch(
+    int n,
+    const double * nWidth,
+    const double * pWidth,
+    int    fanin,
+    enum Gate_type g_type,
+    double * Ig,
+    bool _is_dram,
+    bool _is_cell,
+    bool _is_wl_tr,
+    bool _is_sleep_tx,
+    enum Half_net_topology topo)
+{
+  assert (fanin>=1);
+  const DeviceType * dt = leakage_device(_is_dram, _is_cell, _is_wl_tr, _is_sleep_tx);
+  double nmos_leak[LEAKAGE_CHUNK], pmos_leak[LEAKAGE_CHUNK];
+  for (int i = 0; i < n; i += LEAKAGE_CHUNK)
+  {
+    int m = (n - i < LEAKAGE_CHUNK) ? n - i : LEAKAGE_CHUNK;
+    batch_mul(m, nWidth + i, dt->I_g_on_n, nmos_leak);
+    batch_mul(m, pWidth + i, dt->I_g_on_p, pmos_leak);
+    if (g_type == inv || g_type == tg)
+    {
+      batch_half_sum(m, nmos_leak, pmos_leak, Ig + i);
+      continue;
+    }
+    for (int j = 0; j < m; j++)
+    {
+      Ig[i + j] = Ig_of(nmos_leak[j], pmos_leak[j], fanin, g_type, topo);
+    }
+  }
+}
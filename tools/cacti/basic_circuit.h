@@ -46,6 +46,8 @@ bool is_pow2(int64_t val);
 uint32_t _log2(uint64_t num);
 int factorial(int n, int m = 1);
 int combination(int n, int m);
+// 64-bit FNV-1a hash of len bytes, continuing from h
+uint64_t hash_bytes(const void * data, size_t len, uint64_t h = 14695981039346656037ULL);
 
 //#define DBG
 #ifdef DBG
@@ -235,6 +237,69 @@ double cmos_Ig_leakage(
     bool _is_sleep_tx = false,
     enum Half_net_topology topo = series);
 
+// Batched forms of the device equations above. Each evaluates n
+// independent instances from arrays and gives the same bits as calling the
+// scalar function on every element. The device type is resolved once per
+// call rather than once per element.
+void gate_C_batch(
+    int n,
+    const double * width,
+    double * c,
+    bool _is_dram = false,
+    bool _is_cell = false,
+    bool _is_wl_tr = false,
+    bool _is_sleep_tx = false);
+
+void drain_C_batch(
+    int n,
+    const double * width,
+    int nchannel,
+    int stack,
+    int next_arg_thresh_folding_width_or_height_cell,
+    double fold_dimension,
+    double * c,
+    bool _is_dram = false,
+    bool _is_cell = false,
+    bool _is_wl_tr = false,
+    bool _is_sleep_tx = false);
+
+void tr_R_on_batch(
+    int n,
+    const double * width,
+    int nchannel,
+    int stack,
+    double * r,
+    bool _is_dram = false,
+    bool _is_cell = false,
+    bool _is_wl_tr = false,
+    bool _is_sleep_tx = false);
+
+void cmos_Isub_leakage_batch(
+    int n,
+    const double * nWidth,
+    const double * pWidth,
+    int    fanin,
+    enum Gate_type g_type,
+    double * Isub,
+    bool _is_dram = false,
+    bool _is_cell = false,
+    bool _is_wl_tr = false,
+    bool _is_sleep_tx = false,
+    enum Half_net_topology topo = series);
+
+void cmos_Ig_leakage_batch(
+    int n,
+    const double * nWidth,
+    const double * pWidth,
+    int    fanin,
+    enum Gate_type g_type,
+    double * Ig,
+    bool _is_dram = false,
+    bool _is_cell = false,
+    bool _is_wl_tr = false,
+    bool _is_sleep_tx = false,
+    enum Half_net_topology topo = series);
+
 double shortcircuit(
     double vt,
     double velocity_index,
@@ -1,13 +1,8 @@
 TARGET = cacti
 SHELL = /bin/sh
-.PHONY: all depend clean
+.PHONY: all depend clean python api_test
 .SUFFIXES: .cc .o
 
-ifndef NTHREADS
-  NTHREADS = 8
-endif
-
-
 LIBS = 
 INCS = -lm
 
@@ -16,7 +11,14 @@ ifeq ($(TAG),dbg)
   OPT = -ggdb -g -O0 -DNTHREADS=1  -gstabs+
 else
   DBG = 
-  OPT = -g  -msse2 -mfpmath=sse -DNTHREADS=$(NTHREADS)
+  OPT = -g  -msse2 -mfpmath=sse
+  # the thread pool sizes itself to the online CPUs unless NTHREADS is given
+  ifdef NTHREADS
+    OPT += -DNTHREADS=$(NTHREADS)
+  endif
+  ifeq ($(TAG),py)
+    OPT += -fPIC
+  endif
 endif
 
 #CXXFLAGS = -Wall -Wno-unknown-pragmas -Winline $(DBG) $(OPT) 
@@ -27,13 +29,18 @@ CC  = gcc -m64
 SRCS  = area.cc bank.cc mat.cc main.cc Ucache.cc io.cc technology.cc basic_circuit.cc parameter.cc \
 		decoder.cc component.cc uca.cc subarray.cc wire.cc htree2.cc extio.cc extio_technology.cc \
 		cacti_interface.cc router.cc nuca.cc crossbar.cc arbiter.cc powergating.cc TSV.cc memorybus.cc \
-		memcad.cc memcad_parameters.cc
+		memcad.cc memcad_parameters.cc thread_pool.cc sweep.cc partition_memo.cc arena.cc pareto.cc \
+		profile.cc server.cc design_dump.cc
 		
 
 OBJS = $(patsubst %.cc,obj_$(TAG)/%.o,$(SRCS))
-PYTHONLIB_SRCS = $(patsubst main.cc, ,$(SRCS)) obj_$(TAG)/cacti_wrap.cc
-PYTHONLIB_OBJS = $(patsubst %.cc,%.o,$(PYTHONLIB_SRCS)) 
-INCLUDES       = -I /usr/include/python2.4 -I /usr/lib/python2.4/config
+PYTHON_CONFIG  = python3-config
+PYTHONLIB      = cacti$(shell $(PYTHON_CONFIG) --extension-suffix)
+PYTHONLIB_SRCS = $(patsubst main.cc, ,$(SRCS)) python_module.cc
+PYTHONLIB_OBJS = $(patsubst %.cc,obj_$(TAG)/%.o,$(PYTHONLIB_SRCS))
+API_TEST_SRCS  = $(patsubst main.cc, ,$(SRCS)) api_test.cc
+API_TEST_OBJS  = $(patsubst %.cc,obj_$(TAG)/%.o,$(API_TEST_SRCS))
+INCLUDES       = $(shell $(PYTHON_CONFIG) --includes)
 
 all: obj_$(TAG)/$(TARGET)
 	cp -f obj_$(TAG)/$(TARGET) $(TARGET)
@@ -41,13 +48,22 @@ all: obj_$(TAG)/$(TARGET)
 obj_$(TAG)/$(TARGET) : $(OBJS)
 	$(CXX) $(OBJS) -o $@ $(INCS) $(CXXFLAGS) $(LIBS) -pthread
 
+python: $(PYTHONLIB_OBJS)
+	$(CXX) -shared $(PYTHONLIB_OBJS) -o $(PYTHONLIB) $(INCS) $(CXXFLAGS) $(LIBS) -pthread
+
+api_test: $(API_TEST_OBJS)
+	$(CXX) $(API_TEST_OBJS) -o api_test $(INCS) $(CXXFLAGS) $(LIBS) -pthread
+
 #obj_$(TAG)/%.o : %.cc
 #	$(CXX) -c $(CXXFLAGS) $(INCS) -o $@ $<
 
+obj_$(TAG)/python_module.o : python_module.cc
+	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $< -o $@
+
 obj_$(TAG)/%.o : %.cc
 	$(CXX) $(CXXFLAGS) -c $< -o $@
 
 clean:
-	-rm -f *.o _cacti.so cacti.py $(TARGET)
+	-rm -f *.o $(PYTHONLIB) $(TARGET) api_test
 
 
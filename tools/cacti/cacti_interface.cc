@@ -42,6 +42,7 @@
 #include "Ucache.h"
 
 #include <pthread.h>
+#include <string.h>
 #include <iostream>
 #include <algorithm>
 
@@ -66,6 +67,57 @@ bool mem_array::lt(const mem_array * m1, const mem_array * m2)
 
 
 
+#define MEM_ARRAY_WORDS  ((sizeof(mem_array) + 7) / 8)
+#define MEM_ARRAY_BITMAP ((MEM_ARRAY_WORDS + 63) / 64)
+
+void mem_array::pack(vector<uint64_t> & out) const
+{
+  uint64_t words[MEM_ARRAY_WORDS];
+  words[MEM_ARRAY_WORDS - 1] = 0;
+  memcpy(words, (const void *) this, sizeof(mem_array));
+
+  size_t bitmap = out.size();
+  out.resize(bitmap + MEM_ARRAY_BITMAP, 0);
+  for (uint32_t w = 0; w < MEM_ARRAY_WORDS; w++)
+  {
+    if (words[w] != 0)
+    {
+      out[bitmap + w / 64] |= (uint64_t) 1 << (w % 64);
+      out.push_back(words[w]);
+    }
+  }
+}
+
+
+
+const uint64_t * mem_array::unpack(const uint64_t * p, mem_array & m)
+{
+  uint64_t words[MEM_ARRAY_WORDS];
+  const uint64_t * bitmap = p;
+  p += MEM_ARRAY_BITMAP;
+
+  for (uint32_t w = 0; w < MEM_ARRAY_WORDS; w++)
+  {
+    words[w] = (bitmap[w / 64] & ((uint64_t) 1 << (w % 64))) ? *p++ : 0;
+  }
+  memcpy((void *) &m, words, sizeof(mem_array));
+  return p;
+}
+
+
+
+uint32_t mem_array::packed_size(const uint64_t * p)
+{
+  uint32_t n = MEM_ARRAY_BITMAP;
+  for (uint32_t i = 0; i < MEM_ARRAY_BITMAP; i++)
+  {
+    n += __builtin_popcountll(p[i]);
+  }
+  return n;
+}
+
+
+
 void uca_org_t::find_delay() 
 {
   mem_array * data_arr = data_array2;
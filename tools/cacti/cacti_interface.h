@@ -47,6 +47,7 @@ using namespace std;
 class min_values_t;
 class mem_array;
 class uca_org_t;
+class SolverContext;
 
 
 class powerComponents
@@ -172,6 +173,7 @@ class InputParameter
 
     InputParameter();
     void parse_cfg(const string & infile);
+    void parse_cfg(const vector<string> & lines);
 
     bool error_checking();  // return false if the input parameters are problematic
     void display_ip();
@@ -294,7 +296,7 @@ class InputParameter
 	double addr_timing, duty_cycle, mem_density, bus_bw, activity_dq, activity_ca, bus_freq;
 	int mem_data_width, num_mem_dq, num_clk, num_ca, num_dqs, num_dq; 
 	
-	double rtt_value, ron_value, tflight_value; //FIXME
+	double rtt_value, ron_value, tflight_value;
 	
 	Mem_state iostate;
 	
@@ -517,6 +519,19 @@ class uca_org_t
 };
 
 
+// Power of a solved organization at one operating temperature.
+class uca_temp_power_t
+{
+  public:
+    unsigned int temp;
+    powerDef power;       // whole array, as uca_org_t::power
+    powerDef data_power;
+    powerDef tag_power;   // zero without a tag array
+
+    uca_temp_power_t() : temp(0) { }
+};
+
+
 class IO_org_t
 {
 	public:
@@ -534,10 +549,27 @@ class IO_org_t
 
 
 void reconfigure(InputParameter *local_interface, uca_org_t *fin_res);
+// rank the candidates of the last cacti_interface() call on this thread
+// again after a change of objective weights or deviation limits only
+uca_org_t rerank_interface(InputParameter * const local_interface);
+// power of the organization in fin_res at each temperature (K) of temps,
+// without searching the partitions again; res[i] belongs to temps[i].
+// All temperatures are evaluated in one pass on the thread pool, and
+// local_interface, fin_res and the thread's tech tables are left as they
+// are. False if a temperature is not one of 300, 310, ..., 400.
+bool temperature_sweep(InputParameter * const local_interface, const uca_org_t & fin_res,
+    const vector<unsigned int> & temps, vector<uca_temp_power_t> & res);
 
 uca_org_t cacti_interface(const string & infile_name);
 //McPAT's plain interface, please keep !!!
 uca_org_t cacti_interface(InputParameter * const local_interface);
+// Same as above, but solved in the given context, which is only bound for
+// the duration of the call. Independent configurations can be solved
+// concurrently as long as each thread uses its own context.
+uca_org_t cacti_interface(SolverContext * ctx, InputParameter * const local_interface);
+// Solves every configuration in its own context, in parallel on the thread
+// pool; results[i] belongs to configs[i].
+void cacti_interface(const vector<InputParameter *> & configs, vector<uca_org_t> & results);
 //McPAT's plain interface, please keep !!!
 uca_org_t init_interface(InputParameter * const local_interface);
 //McPAT's plain interface, please keep !!!
@@ -888,6 +920,12 @@ class mem_array
 
   static bool lt(const mem_array * m1, const mem_array * m2);
 
+  // Packed form: a bitmap of the non-zero 64-bit words of the record
+  // followed by those words. Most of them are zero for any one array type.
+  void pack(vector<uint64_t> & out) const;
+  static const uint64_t * unpack(const uint64_t * p, mem_array & m);
+  static uint32_t packed_size(const uint64_t * p);  // in words
+
   //CACTI3DD 3d dram stats
   double t_RCD, t_RAS, t_RC, t_CAS, t_RP, t_RRD;
   double activate_power, read_power, write_power, peak_read_power;
@@ -36,6 +36,7 @@
 #include <iostream>
 #include <math.h>
 
+#include "arena.h"
 #include "bank.h"
 #include "component.h"
 #include "decoder.h"
@@ -57,6 +58,44 @@ Component::~Component()
 
 
 
+// Each component is preceded by a header telling whether it came from an
+// arena, in which case deleting it is left to the arena.
+#define COMPONENT_HEADER 16
+
+void * Component::operator new(size_t size)
+{
+  Arena * arena = Arena::active();
+  char  * p;
+
+  if (arena != NULL)
+  {
+    p = (char *) arena->alloc(size + COMPONENT_HEADER);
+  }
+  else
+  {
+    p = (char *) ::operator new(size + COMPONENT_HEADER);
+  }
+  *(bool *) p = (arena != NULL);
+  return p + COMPONENT_HEADER;
+}
+
+
+
+void Component::operator delete(void * p)
+{
+  if (p == NULL)
+  {
+    return;
+  }
+  char * base = (char *) p - COMPONENT_HEADER;
+  if (!*(bool *) base)
+  {
+    ::operator delete(base);
+  }
+}
+
+
+
 double Component::compute_diffusion_width(int num_stacked_in, int num_folded_tr)
 {
   double w_poly = g_ip->F_sz_um;
@@ -208,11 +247,17 @@ int Component::logical_effort(
   double f = pow(F, 1.0 / num_gates);
   int    i = num_gates - 1;
   double C_in = C_load / f;
-  w_n[i]  = (1.0 / (1.0 + p_to_n_sz_ratio)) * C_in / gate_C(1, 0, is_dram_, false, is_wl_tr_);
-  w_n[i]  = MAX(w_n[i], g_tp.min_w_nmos_);
-  w_p[i]  = p_to_n_sz_ratio * w_n[i];
+  double w_last = (1.0 / (1.0 + p_to_n_sz_ratio)) * C_in / gate_C(1, 0, is_dram_, false, is_wl_tr_);
+  w_last = MAX(w_last, g_tp.min_w_nmos_);
+  // for huge loads num_gates only fits the arrays once it is recomputed
+  // for max_w_nmos below
+  if (i < MAX_NUMBER_GATES_STAGE)
+  {
+    w_n[i]  = w_last;
+    w_p[i]  = p_to_n_sz_ratio * w_n[i];
+  }
 
-  if (w_n[i] > max_w_nmos) // && !g_ip->is_3d_mem)
+  if (w_last > max_w_nmos) // && !g_ip->is_3d_mem)
   {
     double C_ld = gate_C((1 + p_to_n_sz_ratio) * max_w_nmos, 0, is_dram_, false, is_wl_tr_);
     F = g * C_ld / gate_C(w_n[0] + w_p[0], 0, is_dram_, false, is_wl_tr_);
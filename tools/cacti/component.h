@@ -48,6 +48,10 @@ class Component
     Component();
     ~Component();
 
+    // taken from the thread's Arena while an ArenaScope is open (arena.h)
+    static void * operator new(size_t size);
+    static void   operator delete(void * p);
+
     Area area;
     powerDef power,rt_power;
     double delay;
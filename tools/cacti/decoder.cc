@@ -37,10 +37,129 @@
 #include <iostream>
 #include <math.h>
 #include <assert.h>
+#include <map>
+#include <pthread.h>
 
 using namespace std;
 
 
+// Results of sizing a gate chain and of its delay, shared by every
+// partition whose decoder, predecoder block or driver has the same inputs.
+// Keys start with the technology's load key (see sizing_key()), so they are
+// only built when g_tp came from TechnologyParameter::load.
+#define CHAIN_CACHE_MAX_ENTRIES 65536
+
+template<class T>
+class Chain_cache
+{
+ public:
+  Chain_cache() { pthread_mutex_init(&lock, NULL); }
+
+  bool find(const vector<double> & key, T & val)
+  {
+    pthread_mutex_lock(&lock);
+    typename map<vector<double>, T>::const_iterator it = entries.find(key);
+    bool found = (it != entries.end());
+    if (found)
+    {
+      val = it->second;
+    }
+    pthread_mutex_unlock(&lock);
+    return found;
+  }
+
+  void insert(const vector<double> & key, const T & val)
+  {
+    pthread_mutex_lock(&lock);
+    if (entries.size() >= CHAIN_CACHE_MAX_ENTRIES)
+    {
+      entries.clear();
+    }
+    entries.insert(make_pair(key, val));
+    pthread_mutex_unlock(&lock);
+  }
+
+ private:
+  pthread_mutex_t lock;
+  map<vector<double>, T> entries;
+};
+
+enum Chain_kind
+{
+  chain_decoder,
+  chain_predec_blk,
+  chain_driver
+};
+
+static bool chain_key(vector<double> & key, Chain_kind kind)
+{
+  if (g_tp.load_key.empty())
+  {
+    return false;
+  }
+  key = g_tp.load_key;
+  key.push_back(kind);
+  return true;
+}
+
+struct Decoder_sizing
+{
+  int    num_gates;
+  double w_dec_n[MAX_NUMBER_GATES_STAGE];
+  double w_dec_p[MAX_NUMBER_GATES_STAGE];
+  Area   area;
+  powerDef power;
+};
+
+struct PredecBlk_sizing
+{
+  int    branch_effort_nand2_gate_output;
+  int    branch_effort_nand3_gate_output;
+  bool   flag_two_unique_paths;
+  int    flag_L2_gate;
+  int    number_inputs_L1_gate;
+  int    number_gates_L1_nand2_path;
+  int    number_gates_L1_nand3_path;
+  int    number_gates_L2;
+  int    num_L1_active_nand2_path;
+  int    num_L1_active_nand3_path;
+  double w_L1_nand2_n[MAX_NUMBER_GATES_STAGE];
+  double w_L1_nand2_p[MAX_NUMBER_GATES_STAGE];
+  double w_L1_nand3_n[MAX_NUMBER_GATES_STAGE];
+  double w_L1_nand3_p[MAX_NUMBER_GATES_STAGE];
+  double w_L2_n[MAX_NUMBER_GATES_STAGE];
+  double w_L2_p[MAX_NUMBER_GATES_STAGE];
+  Area   area;
+  powerDef power_nand2_path;
+  powerDef power_nand3_path;
+  powerDef power_L2;
+};
+
+struct Driver_sizing
+{
+  int    number_gates;
+  double width_n[MAX_NUMBER_GATES_STAGE];
+  double width_p[MAX_NUMBER_GATES_STAGE];
+  Area   area;
+};
+
+// what a chain's delay computation adds to its (still zero) results
+struct Chain_delay
+{
+  double delay[2];
+  double dynamic[3];
+  double leakage;
+  double gate_leakage;
+  double outrisetime[2];
+};
+
+static Chain_cache<Decoder_sizing>   decoder_sizings;
+static Chain_cache<PredecBlk_sizing> predec_blk_sizings;
+static Chain_cache<Driver_sizing>    driver_sizings;
+static Chain_cache<Chain_delay>      chain_delays;
+
+
+
 Decoder::Decoder(
     int    _num_dec_signals,
     bool   flag_way_select,
@@ -109,9 +228,55 @@ Decoder::Decoder(
   //area.h = 4 * cell.h;
   area.h = g_tp.h_dec * cell.h;
 
+  vector<double> key;
+  Decoder_sizing sz;
+  bool shared = sizing_key(key);
+  if (shared && decoder_sizings.find(key, sz))
+  {
+    num_gates = sz.num_gates;
+    for (int i = 0; i < MAX_NUMBER_GATES_STAGE; i++)
+    {
+      w_dec_n[i] = sz.w_dec_n[i];
+      w_dec_p[i] = sz.w_dec_p[i];
+    }
+    area  = sz.area;
+    power = sz.power;
+    return;
+  }
+
   compute_widths();
   compute_area();
 
+  if (shared)
+  {
+    sz.num_gates = num_gates;
+    for (int i = 0; i < MAX_NUMBER_GATES_STAGE; i++)
+    {
+      sz.w_dec_n[i] = w_dec_n[i];
+      sz.w_dec_p[i] = w_dec_p[i];
+    }
+    sz.area  = area;
+    sz.power = power;
+    decoder_sizings.insert(key, sz);
+  }
+}
+
+
+
+bool Decoder::sizing_key(vector<double> & key)
+{
+  if (!chain_key(key, chain_decoder))
+  {
+    return false;
+  }
+  key.push_back(exist);
+  key.push_back(num_in_signals);
+  key.push_back(fully_assoc);
+  key.push_back(C_ld_dec_out);
+  key.push_back(is_dram);
+  key.push_back(is_wl_tr);
+  key.push_back(area.h);
+  return true;
 }
 
 
@@ -178,11 +343,14 @@ void Decoder::compute_area()
       cumulative_curr_Ig = cmos_Ig_leakage(w_dec_n[0], w_dec_p[0], 3, nand, is_dram);
     }
 
+    double i_sub[MAX_NUMBER_GATES_STAGE], i_g[MAX_NUMBER_GATES_STAGE];
+    cmos_Isub_leakage_batch(num_gates - 1, w_dec_n + 1, w_dec_p + 1, 1, inv, i_sub + 1, is_dram);
+    cmos_Ig_leakage_batch(num_gates - 1, w_dec_n + 1, w_dec_p + 1, 1, inv, i_g + 1, is_dram);
     for (int i = 1; i < num_gates; i++)
     {
       cumulative_area += compute_gate_area(INV, 1, w_dec_p[i], w_dec_n[i], area.h);
-      cumulative_curr += cmos_Isub_leakage(w_dec_n[i], w_dec_p[i], 1, inv, is_dram);
-      cumulative_curr_Ig = cmos_Ig_leakage(w_dec_n[i], w_dec_p[i], 1, inv, is_dram);
+      cumulative_curr += i_sub[i];
+      cumulative_curr_Ig = i_g[i];
     }
     power.readOp.leakage = cumulative_curr * g_tp.peri_global.Vdd;
     power.readOp.gate_leakage = cumulative_curr_Ig * g_tp.peri_global.Vdd;
@@ -223,6 +391,22 @@ double Decoder::compute_delays(double inrisetime)
 {
   if (exist)
   {
+    vector<double> key;
+    Chain_delay d;
+    bool shared = (delay == 0 && power.readOp.dynamic == 0 && sizing_key(key));
+    if (shared)
+    {
+      key.push_back(R_wire_dec_out);
+      key.push_back(inrisetime);
+      if (chain_delays.find(key, d))
+      {
+        delay = d.delay[0];
+        power.readOp.dynamic = d.dynamic[0];
+        compute_power_gating();
+        return d.outrisetime[0];
+      }
+    }
+
     double ret_val = 0;  // outrisetime
     int    i;
     double rd, tf, this_delay, c_load, c_intrinsic, Vpp;
@@ -252,12 +436,25 @@ double Decoder::compute_delays(double inrisetime)
     inrisetime = this_delay / (1.0 - 0.5);
     power.readOp.dynamic += (c_load + c_intrinsic) * Vdd * Vdd;
 
+    // the inverter stages' resistances and capacitances do not depend on
+    // each other, so they are evaluated as one batch per stage index
+    double rd_s[MAX_NUMBER_GATES_STAGE], c_load_s[MAX_NUMBER_GATES_STAGE];
+    double c_p_s[MAX_NUMBER_GATES_STAGE], c_n_s[MAX_NUMBER_GATES_STAGE];
+    double w_load[MAX_NUMBER_GATES_STAGE];
+    for (i = 1; i < num_gates - 1; ++i)
+    {
+      w_load[i] = w_dec_p[i+1] + w_dec_n[i+1];
+    }
+    tr_R_on_batch(num_gates - 1, w_dec_n + 1, NCH, 1, rd_s + 1, is_dram, false, is_wl_tr);
+    gate_C_batch(num_gates - 2, w_load + 1, c_load_s + 1, is_dram, false, is_wl_tr);
+    drain_C_batch(num_gates - 1, w_dec_p + 1, PCH, 1, 1, area.h, c_p_s + 1, is_dram, false, is_wl_tr);
+    drain_C_batch(num_gates - 1, w_dec_n + 1, NCH, 1, 1, area.h, c_n_s + 1, is_dram, false, is_wl_tr);
+
     for (i = 1; i < num_gates - 1; ++i)
     {
-      rd = tr_R_on(w_dec_n[i], NCH, 1, is_dram, false, is_wl_tr);
-      c_load = gate_C(w_dec_p[i+1] + w_dec_n[i+1], 0.0, is_dram, false, is_wl_tr);
-      c_intrinsic = drain_C_(w_dec_p[i], PCH, 1, 1, area.h, is_dram, false, is_wl_tr) +
-                    drain_C_(w_dec_n[i], NCH, 1, 1, area.h, is_dram, false, is_wl_tr);
+      rd = rd_s[i];
+      c_load = c_load_s[i];
+      c_intrinsic = c_p_s[i] + c_n_s[i];
       tf = rd * (c_intrinsic + c_load);
       this_delay = horowitz(inrisetime, tf, 0.5, 0.5, RISE);
       delay += this_delay;
@@ -268,15 +465,22 @@ double Decoder::compute_delays(double inrisetime)
     // add delay of final inverter that drives the wordline
     i = num_gates - 1;
     c_load = C_ld_dec_out;
-    rd = tr_R_on(w_dec_n[i], NCH, 1, is_dram, false, is_wl_tr);
-    c_intrinsic = drain_C_(w_dec_p[i], PCH, 1, 1, area.h, is_dram, false, is_wl_tr) +
-                  drain_C_(w_dec_n[i], NCH, 1, 1, area.h, is_dram, false, is_wl_tr);
+    rd = rd_s[i];
+    c_intrinsic = c_p_s[i] + c_n_s[i];
     tf = rd * (c_intrinsic + c_load) + R_wire_dec_out * c_load / 2;
     this_delay = horowitz(inrisetime, tf, 0.5, 0.5, RISE);
     delay  += this_delay;
     ret_val = this_delay / (1.0 - 0.5);
     power.readOp.dynamic += c_load * Vpp * Vpp + c_intrinsic * Vdd * Vdd;
 
+    if (shared)
+    {
+      d.delay[0] = delay;
+      d.dynamic[0] = power.readOp.dynamic;
+      d.outrisetime[0] = ret_val;
+      chain_delays.insert(key, d);
+    }
+
     compute_power_gating();
     return ret_val;
   }
@@ -304,10 +508,13 @@ void Decoder::leakage_feedback(double temperature)
       cumulative_curr_Ig = cmos_Ig_leakage(w_dec_n[0], w_dec_p[0], 3, nand, is_dram);
     }
 
+    double i_sub[MAX_NUMBER_GATES_STAGE], i_g[MAX_NUMBER_GATES_STAGE];
+    cmos_Isub_leakage_batch(num_gates - 1, w_dec_n + 1, w_dec_p + 1, 1, inv, i_sub + 1, is_dram);
+    cmos_Ig_leakage_batch(num_gates - 1, w_dec_n + 1, w_dec_p + 1, 1, inv, i_g + 1, is_dram);
     for (int i = 1; i < num_gates; i++)
     {
-      cumulative_curr += cmos_Isub_leakage(w_dec_n[i], w_dec_p[i], 1, inv, is_dram);
-      cumulative_curr_Ig = cmos_Ig_leakage(w_dec_n[i], w_dec_p[i], 1, inv, is_dram);
+      cumulative_curr += i_sub[i];
+      cumulative_curr_Ig = i_g[i];
     }
 
     power.readOp.leakage = cumulative_curr * g_tp.peri_global.Vdd;
@@ -396,8 +603,82 @@ PredecBlk::PredecBlk(
     }
   }
 
+  vector<double> key;
+  PredecBlk_sizing sz;
+  bool shared = sizing_key(key);
+  if (shared && predec_blk_sizings.find(key, sz))
+  {
+    branch_effort_nand2_gate_output = sz.branch_effort_nand2_gate_output;
+    branch_effort_nand3_gate_output = sz.branch_effort_nand3_gate_output;
+    flag_two_unique_paths      = sz.flag_two_unique_paths;
+    flag_L2_gate               = sz.flag_L2_gate;
+    number_inputs_L1_gate      = sz.number_inputs_L1_gate;
+    number_gates_L1_nand2_path = sz.number_gates_L1_nand2_path;
+    number_gates_L1_nand3_path = sz.number_gates_L1_nand3_path;
+    number_gates_L2            = sz.number_gates_L2;
+    num_L1_active_nand2_path   = sz.num_L1_active_nand2_path;
+    num_L1_active_nand3_path   = sz.num_L1_active_nand3_path;
+    for (int i = 0; i < MAX_NUMBER_GATES_STAGE; i++)
+    {
+      w_L1_nand2_n[i] = sz.w_L1_nand2_n[i];
+      w_L1_nand2_p[i] = sz.w_L1_nand2_p[i];
+      w_L1_nand3_n[i] = sz.w_L1_nand3_n[i];
+      w_L1_nand3_p[i] = sz.w_L1_nand3_p[i];
+      w_L2_n[i] = sz.w_L2_n[i];
+      w_L2_p[i] = sz.w_L2_p[i];
+    }
+    area = sz.area;
+    power_nand2_path = sz.power_nand2_path;
+    power_nand3_path = sz.power_nand3_path;
+    power_L2 = sz.power_L2;
+    return;
+  }
+
   compute_widths();
   compute_area();
+
+  if (shared)
+  {
+    sz.branch_effort_nand2_gate_output = branch_effort_nand2_gate_output;
+    sz.branch_effort_nand3_gate_output = branch_effort_nand3_gate_output;
+    sz.flag_two_unique_paths      = flag_two_unique_paths;
+    sz.flag_L2_gate               = flag_L2_gate;
+    sz.number_inputs_L1_gate      = number_inputs_L1_gate;
+    sz.number_gates_L1_nand2_path = number_gates_L1_nand2_path;
+    sz.number_gates_L1_nand3_path = number_gates_L1_nand3_path;
+    sz.number_gates_L2            = number_gates_L2;
+    sz.num_L1_active_nand2_path   = num_L1_active_nand2_path;
+    sz.num_L1_active_nand3_path   = num_L1_active_nand3_path;
+    for (int i = 0; i < MAX_NUMBER_GATES_STAGE; i++)
+    {
+      sz.w_L1_nand2_n[i] = w_L1_nand2_n[i];
+      sz.w_L1_nand2_p[i] = w_L1_nand2_p[i];
+      sz.w_L1_nand3_n[i] = w_L1_nand3_n[i];
+      sz.w_L1_nand3_p[i] = w_L1_nand3_p[i];
+      sz.w_L2_n[i] = w_L2_n[i];
+      sz.w_L2_p[i] = w_L2_p[i];
+    }
+    sz.area = area;
+    sz.power_nand2_path = power_nand2_path;
+    sz.power_nand3_path = power_nand3_path;
+    sz.power_L2 = power_L2;
+    predec_blk_sizings.insert(key, sz);
+  }
+}
+
+
+
+bool PredecBlk::sizing_key(vector<double> & key)
+{
+  if (!chain_key(key, chain_predec_blk))
+  {
+    return false;
+  }
+  key.push_back(exist);
+  key.push_back(number_input_addr_bits);
+  key.push_back(C_ld_predec_blk_out);
+  key.push_back(is_dram_);
+  return true;
 }
 
 
@@ -750,6 +1031,31 @@ pair<double, double> PredecBlk::compute_delays(
   double rd, c_load, c_intrinsic, tf, this_delay;
   double Vdd = g_tp.peri_global.Vdd;
 
+  vector<double> key;
+  Chain_delay d;
+  bool shared = (delay_nand2_path == 0 && delay_nand3_path == 0 &&
+                 power_nand2_path.readOp.dynamic == 0 &&
+                 power_nand3_path.readOp.dynamic == 0 &&
+                 power_L2.readOp.dynamic == 0 && sizing_key(key));
+  if (shared)
+  {
+    key.push_back(R_wire_predec_blk_out);
+    key.push_back(inrisetime.first);
+    key.push_back(inrisetime.second);
+    if (chain_delays.find(key, d))
+    {
+      delay_nand2_path = d.delay[0];
+      delay_nand3_path = d.delay[1];
+      power_nand2_path.readOp.dynamic = d.dynamic[0];
+      power_nand3_path.readOp.dynamic = d.dynamic[1];
+      power_L2.readOp.dynamic = d.dynamic[2];
+      ret_val.first  = d.outrisetime[0];
+      ret_val.second = d.outrisetime[1];
+      delay = (ret_val.first > ret_val.second) ? ret_val.first : ret_val.second;
+      return ret_val;
+    }
+  }
+
   // TODO: following delay calculation part can be greatly simplified.
   // first check whether a predecoder block is required
   if (exist)
@@ -925,6 +1231,18 @@ pair<double, double> PredecBlk::compute_delays(
     }
   }
 
+  if (shared)
+  {
+    d.delay[0] = delay_nand2_path;
+    d.delay[1] = delay_nand3_path;
+    d.dynamic[0] = power_nand2_path.readOp.dynamic;
+    d.dynamic[1] = power_nand3_path.readOp.dynamic;
+    d.dynamic[2] = power_L2.readOp.dynamic;
+    d.outrisetime[0] = ret_val.first;
+    d.outrisetime[1] = ret_val.second;
+    chain_delays.insert(key, d);
+  }
+
   delay = (ret_val.first > ret_val.second) ? ret_val.first : ret_val.second;
   return ret_val;
 }
@@ -1547,8 +1865,48 @@ Driver::Driver(double c_gate_load_, double c_wire_load_, double r_wire_load_, bo
     width_p[i] = 0;
   }
 
+  vector<double> key;
+  Driver_sizing sz;
+  bool shared = sizing_key(key);
+  if (shared && driver_sizings.find(key, sz))
+  {
+    number_gates = sz.number_gates;
+    for (int i = 0; i < MAX_NUMBER_GATES_STAGE; i++)
+    {
+      width_n[i] = sz.width_n[i];
+      width_p[i] = sz.width_p[i];
+    }
+    area = sz.area;
+    return;
+  }
+
   compute_widths();
   compute_area();
+
+  if (shared)
+  {
+    sz.number_gates = number_gates;
+    for (int i = 0; i < MAX_NUMBER_GATES_STAGE; i++)
+    {
+      sz.width_n[i] = width_n[i];
+      sz.width_p[i] = width_p[i];
+    }
+    sz.area = area;
+    driver_sizings.insert(key, sz);
+  }
+}
+
+
+bool Driver::sizing_key(vector<double> & key)
+{
+  if (!chain_key(key, chain_driver))
+  {
+    return false;
+  }
+  key.push_back(c_gate_load);
+  key.push_back(c_wire_load);
+  key.push_back(is_dram_);
+  return true;
 }
 
 
@@ -1623,32 +1981,74 @@ double Driver::compute_delay(double inrisetime)
   double rd, c_load, c_intrinsic, tf;
   double this_delay = 0;
 
+  vector<double> key;
+  Chain_delay d;
+  bool shared = (delay == 0 && power.readOp.dynamic == 0 &&
+                 power.readOp.leakage == 0 && power.readOp.gate_leakage == 0 &&
+                 sizing_key(key));
+  if (shared)
+  {
+    key.push_back(r_wire_load);
+    key.push_back(inrisetime);
+    if (chain_delays.find(key, d))
+    {
+      delay = d.delay[0];
+      power.readOp.dynamic = d.dynamic[0];
+      power.readOp.leakage = d.leakage;
+      power.readOp.gate_leakage = d.gate_leakage;
+      return d.outrisetime[0];
+    }
+  }
+
+  double rd_s[MAX_NUMBER_GATES_STAGE], c_load_s[MAX_NUMBER_GATES_STAGE];
+  double c_p_s[MAX_NUMBER_GATES_STAGE], c_n_s[MAX_NUMBER_GATES_STAGE];
+  double i_sub[MAX_NUMBER_GATES_STAGE], i_g[MAX_NUMBER_GATES_STAGE];
+  double w_load[MAX_NUMBER_GATES_STAGE];
   for (i = 0; i < number_gates - 1; ++i)
   {
-    rd = tr_R_on(width_n[i], NCH, 1, is_dram_);
-    c_load = gate_C(width_n[i+1] + width_p[i+1], 0.0, is_dram_);
-    c_intrinsic = drain_C_(width_p[i], PCH, 1, 1, g_tp.cell_h_def, is_dram_) +
-                  drain_C_(width_n[i], NCH, 1, 1, g_tp.cell_h_def, is_dram_);
+    w_load[i] = width_n[i+1] + width_p[i+1];
+  }
+  tr_R_on_batch(number_gates, width_n, NCH, 1, rd_s, is_dram_);
+  gate_C_batch(number_gates - 1, w_load, c_load_s, is_dram_);
+  drain_C_batch(number_gates, width_p, PCH, 1, 1, g_tp.cell_h_def, c_p_s, is_dram_);
+  drain_C_batch(number_gates, width_n, NCH, 1, 1, g_tp.cell_h_def, c_n_s, is_dram_);
+  cmos_Isub_leakage_batch(number_gates, width_n, width_p, 1, inv, i_sub, is_dram_);
+  cmos_Ig_leakage_batch(number_gates, width_n, width_p, 1, inv, i_g, is_dram_);
+
+  for (i = 0; i < number_gates - 1; ++i)
+  {
+    rd = rd_s[i];
+    c_load = c_load_s[i];
+    c_intrinsic = c_p_s[i] + c_n_s[i];
     tf = rd * (c_intrinsic + c_load);
     this_delay = horowitz(inrisetime, tf, 0.5, 0.5, RISE);
     delay += this_delay;
     inrisetime = this_delay / (1.0 - 0.5);
     power.readOp.dynamic += (c_intrinsic + c_load) * g_tp.peri_global.Vdd * g_tp.peri_global.Vdd;
-    power.readOp.leakage += cmos_Isub_leakage(width_n[i], width_p[i], 1, inv, is_dram_) *g_tp.peri_global.Vdd;
-    power.readOp.gate_leakage += cmos_Ig_leakage(width_n[i], width_p[i], 1, inv, is_dram_)* g_tp.peri_global.Vdd;
+    power.readOp.leakage += i_sub[i] *g_tp.peri_global.Vdd;
+    power.readOp.gate_leakage += i_g[i]* g_tp.peri_global.Vdd;
   }
 
   i = number_gates - 1;
   c_load = c_gate_load + c_wire_load;
-  rd = tr_R_on(width_n[i], NCH, 1, is_dram_);
-  c_intrinsic = drain_C_(width_p[i], PCH, 1, 1, g_tp.cell_h_def, is_dram_) +
-                drain_C_(width_n[i], NCH, 1, 1, g_tp.cell_h_def, is_dram_);
+  rd = rd_s[i];
+  c_intrinsic = c_p_s[i] + c_n_s[i];
   tf = rd * (c_intrinsic + c_load) + r_wire_load * (c_wire_load / 2 + c_gate_load);
   this_delay = horowitz(inrisetime, tf, 0.5, 0.5, RISE);
   delay += this_delay;
   power.readOp.dynamic += (c_intrinsic + c_load) * g_tp.peri_global.Vdd * g_tp.peri_global.Vdd;
-  power.readOp.leakage += cmos_Isub_leakage(width_n[i], width_p[i], 1, inv, is_dram_) * g_tp.peri_global.Vdd;
-  power.readOp.gate_leakage += cmos_Ig_leakage(width_n[i], width_p[i], 1, inv, is_dram_)* g_tp.peri_global.Vdd;
+  power.readOp.leakage += i_sub[i] * g_tp.peri_global.Vdd;
+  power.readOp.gate_leakage += i_g[i]* g_tp.peri_global.Vdd;
+
+  if (shared)
+  {
+    d.delay[0] = delay;
+    d.dynamic[0] = power.readOp.dynamic;
+    d.leakage = power.readOp.leakage;
+    d.gate_leakage = power.readOp.gate_leakage;
+    d.outrisetime[0] = this_delay / (1.0 - 0.5);
+    chain_delays.insert(key, d);
+  }
 
   return this_delay / (1.0 - 0.5);
 }
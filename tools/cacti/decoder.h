@@ -80,6 +80,7 @@ class Decoder : public Component
     void   compute_area();
     double compute_delays(double inrisetime);  // return outrisetime
     void   compute_power_gating();
+    bool   sizing_key(vector<double> & key);
 
     void leakage_feedback(double temperature);
 
@@ -137,6 +138,7 @@ class PredecBlk : public Component
 
   void compute_widths();
   void compute_area();
+  bool sizing_key(vector<double> & key);
 
   void leakage_feedback(double temperature);
 
@@ -258,6 +260,7 @@ class Driver : public Component
   void   compute_widths();
   void   compute_area();
   double compute_delay(double inrisetime);
+  bool   sizing_key(vector<double> & key);
 
   void   compute_power_gating();
 
@@ -0,0 +1,265 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#include <pthread.h>
+#include <stddef.h>
+#include <string.h>
+#include <fstream>
+#include <iostream>
+
+#include "design_dump.h"
+#include "parameter.h"
+#include "Ucache.h"
+#include "partition_memo.h"
+
+using namespace std;
+
+
+string DesignDump::file_name;
+
+// blocks of concurrent sweeps are appended whole
+static pthread_mutex_t dump_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// one dumped partition, gathered from its mem_array
+struct dump_row
+{
+  uint64_t cand;  // candidate index in the sweep, see init_partition_sweep()
+  int32_t  Ndwl;
+  int32_t  Ndbl;
+  double   Nspd;
+  int32_t  Ndcm;
+  int32_t  Ndsam_lev_1;
+  int32_t  Ndsam_lev_2;
+  int32_t  wire;  // Wire_type
+  double   access_time;
+  double   cycle_time;
+  double   interleave_cycle_time;
+  double   delay_route_to_bank;
+  double   delay_input_htree;
+  double   delay_row_predecode;
+  double   delay_row_decoder;
+  double   delay_bitlines;
+  double   delay_sense_amp;
+  double   delay_subarray_out_drv;
+  double   delay_dout_htree;
+  double   delay_comparator;
+  double   delay_matchlines;
+  double   read_energy;
+  double   write_energy;
+  double   search_energy;
+  double   leakage;
+  double   gate_leakage;
+  double   area;
+  double   area_ram_cells;
+  double   area_efficiency;
+  double   height;
+  double   width;
+};
+
+struct dump_row_column
+{
+  const char * name;
+  char         type;
+  size_t       offset;
+};
+
+#define DUMP_COLUMN(f, t) { #f, t, offsetof(dump_row, f) }
+
+static const dump_row_column dump_columns[] = {
+  DUMP_COLUMN(cand, 'q'),
+  DUMP_COLUMN(Ndwl, 'i'),
+  DUMP_COLUMN(Ndbl, 'i'),
+  DUMP_COLUMN(Nspd, 'd'),
+  DUMP_COLUMN(Ndcm, 'i'),
+  DUMP_COLUMN(Ndsam_lev_1, 'i'),
+  DUMP_COLUMN(Ndsam_lev_2, 'i'),
+  DUMP_COLUMN(wire, 'i'),
+  DUMP_COLUMN(access_time, 'd'),
+  DUMP_COLUMN(cycle_time, 'd'),
+  DUMP_COLUMN(interleave_cycle_time, 'd'),
+  DUMP_COLUMN(delay_route_to_bank, 'd'),
+  DUMP_COLUMN(delay_input_htree, 'd'),
+  DUMP_COLUMN(delay_row_predecode, 'd'),
+  DUMP_COLUMN(delay_row_decoder, 'd'),
+  DUMP_COLUMN(delay_bitlines, 'd'),
+  DUMP_COLUMN(delay_sense_amp, 'd'),
+  DUMP_COLUMN(delay_subarray_out_drv, 'd'),
+  DUMP_COLUMN(delay_dout_htree, 'd'),
+  DUMP_COLUMN(delay_comparator, 'd'),
+  DUMP_COLUMN(delay_matchlines, 'd'),
+  DUMP_COLUMN(read_energy, 'd'),
+  DUMP_COLUMN(write_energy, 'd'),
+  DUMP_COLUMN(search_energy, 'd'),
+  DUMP_COLUMN(leakage, 'd'),
+  DUMP_COLUMN(gate_leakage, 'd'),
+  DUMP_COLUMN(area, 'd'),
+  DUMP_COLUMN(area_ram_cells, 'd'),
+  DUMP_COLUMN(area_efficiency, 'd'),
+  DUMP_COLUMN(height, 'd'),
+  DUMP_COLUMN(width, 'd'),
+};
+#define NUM_DUMP_COLUMNS (sizeof(dump_columns) / sizeof(dump_columns[0]))
+
+
+
+static uint32_t column_width(char type)
+{
+  return (type == 'i') ? 4 : 8;
+}
+
+
+
+static void fill_row(const mem_array_rank & r, const mem_array & m, dump_row & row)
+{
+  row.cand                   = r.idx;
+  row.Ndwl                   = m.Ndwl;
+  row.Ndbl                   = m.Ndbl;
+  row.Nspd                   = m.Nspd;
+  row.Ndcm                   = m.deg_bl_muxing;
+  row.Ndsam_lev_1            = m.Ndsam_lev_1;
+  row.Ndsam_lev_2            = m.Ndsam_lev_2;
+  row.wire                   = m.wt;
+  row.access_time            = m.access_time;
+  row.cycle_time             = m.cycle_time;
+  row.interleave_cycle_time  = m.multisubbank_interleave_cycle_time;
+  row.delay_route_to_bank    = m.delay_route_to_bank;
+  row.delay_input_htree      = m.delay_input_htree;
+  row.delay_row_predecode    = m.delay_row_predecode_driver_and_block;
+  row.delay_row_decoder      = m.delay_row_decoder;
+  row.delay_bitlines         = m.delay_bitlines;
+  row.delay_sense_amp        = m.delay_sense_amp;
+  row.delay_subarray_out_drv = m.delay_subarray_output_driver;
+  row.delay_dout_htree       = m.delay_dout_htree;
+  row.delay_comparator       = m.delay_comparator;
+  row.delay_matchlines       = m.delay_matchlines;
+  row.read_energy            = m.power.readOp.dynamic;
+  row.write_energy           = m.power.writeOp.dynamic;
+  row.search_energy          = m.power.searchOp.dynamic;
+  row.leakage                = m.power.readOp.leakage;
+  row.gate_leakage           = m.power.readOp.gate_leakage;
+  row.area                   = m.area;
+  row.area_ram_cells         = m.area_ram_cells;
+  row.area_efficiency        = m.area_efficiency;
+  row.height                 = m.height;
+  row.width                  = m.width;
+}
+
+
+
+void DesignDump::set_file(const string & name)
+{
+  file_name = name;
+
+  ofstream file(file_name.c_str(), ios::trunc | ios::binary);
+  if (!file.is_open())
+  {
+    cerr << "Design space dump file " << file_name << " could not be opened successfully" << endl;
+    exit(1);
+  }
+
+  dump_file_header fh;
+  memset(&fh, 0, sizeof(fh));
+  memcpy(fh.magic, "CACTIDS1", 8);
+  fh.version     = 1;
+  fh.ncols       = NUM_DUMP_COLUMNS;
+  fh.header_size = sizeof(fh) + NUM_DUMP_COLUMNS * sizeof(dump_column);
+  file.write((const char *) &fh, sizeof(fh));
+
+  for (uint32_t c = 0; c < NUM_DUMP_COLUMNS; c++)
+  {
+    dump_column col;
+    memset(&col, 0, sizeof(col));
+    strncpy(col.name, dump_columns[c].name, sizeof(col.name) - 1);
+    col.type = dump_columns[c].type;
+    file.write((const char *) &col, sizeof(col));
+  }
+  file.close();
+}
+
+
+
+void DesignDump::write(const calc_time_mt_wrapper_struct & sweep, const vector<mem_array_rank> & arr)
+{
+  uint64_t rows = arr.size();
+  uint64_t size = sizeof(dump_block_header);
+  for (uint32_t c = 0; c < NUM_DUMP_COLUMNS; c++)
+  {
+    size += (rows * column_width(dump_columns[c].type) + 7) / 8 * 8;
+  }
+
+  // the block is laid out before the lock is taken
+  vector<char> block(size, 0);
+  dump_block_header & bh = *(dump_block_header *) &block[0];
+  memcpy(bh.magic, "CACTIBLK", 8);
+  bh.block_size  = size;
+  bh.rows        = rows;
+  bh.enumerated  = partition_sweep_size(sweep);
+  bh.config_key  = PartitionMemo::input_key(*g_ip);
+  bh.tech_nm     = g_ip->F_sz_nm;
+  bh.capacity    = g_ip->cache_sz;
+  bh.block_sz    = g_ip->block_sz;
+  bh.assoc       = g_ip->tag_assoc;
+  bh.nbanks      = g_ip->nbanks;
+  bh.is_tag      = sweep.is_tag;
+  bh.pure_ram    = sweep.pure_ram;
+  bh.pure_cam    = sweep.pure_cam;
+  bh.fully_assoc = g_ip->fully_assoc;
+
+  vector<char *> col(NUM_DUMP_COLUMNS);
+  char * p = &block[sizeof(dump_block_header)];
+  for (uint32_t c = 0; c < NUM_DUMP_COLUMNS; c++)
+  {
+    col[c] = p;
+    p += (rows * column_width(dump_columns[c].type) + 7) / 8 * 8;
+  }
+
+  mem_array m;
+  dump_row  row;
+  for (uint64_t i = 0; i < rows; i++)
+  {
+    arr[i].get_detail(m);
+    fill_row(arr[i], m, row);
+    for (uint32_t c = 0; c < NUM_DUMP_COLUMNS; c++)
+    {
+      uint32_t w = column_width(dump_columns[c].type);
+      memcpy(col[c] + i * w, (const char *) &row + dump_columns[c].offset, w);
+    }
+  }
+
+  pthread_mutex_lock(&dump_lock);
+  ofstream file(file_name.c_str(), ios::app | ios::binary);
+  file.write(&block[0], size);
+  file.close();
+  pthread_mutex_unlock(&dump_lock);
+}
@@ -0,0 +1,108 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#ifndef __DESIGN_DUMP_H__
+#define __DESIGN_DUMP_H__
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using namespace std;
+
+struct calc_time_mt_wrapper_struct;
+struct mem_array_rank;
+
+
+// Columnar dump of the design space. With a file set, every partition
+// sweep appends a block holding all the valid partitions it evaluated, in
+// mem_array_rank::lt order, one column after the other. All values are
+// native-endian and 8-byte aligned, so the file can be mapped and read in
+// place (see dump_query.py):
+//
+//   file:   dump_file_header, ncols x dump_column, then the blocks
+//   block:  dump_block_header, then per column rows x width bytes, padded
+//           to a multiple of 8
+//
+// Times are in s, energies in J, power in W and lengths in um, as in
+// mem_array.
+struct dump_file_header
+{
+  char     magic[8];      // "CACTIDS1"
+  uint32_t version;
+  uint32_t ncols;
+  uint32_t header_size;   // including the column table
+  uint32_t reserved;
+};
+
+struct dump_column
+{
+  char     name[24];
+  char     type;          // 'q' uint64, 'i' int32, 'd' double
+  char     reserved[7];
+};
+
+struct dump_block_header
+{
+  char     magic[8];      // "CACTIBLK"
+  uint64_t block_size;    // bytes, header included
+  uint64_t rows;          // valid partitions
+  uint64_t enumerated;    // candidates in the sweep, see partition_sweep_size()
+  uint64_t config_key;    // PartitionMemo::input_key(); tag and data blocks of a solve share it
+  double   tech_nm;
+  double   capacity;      // bytes
+  uint32_t block_sz;
+  uint32_t assoc;
+  uint32_t nbanks;
+  uint8_t  is_tag;
+  uint8_t  pure_ram;
+  uint8_t  pure_cam;
+  uint8_t  fully_assoc;
+};
+
+class DesignDump
+{
+  public:
+    // truncates the file and writes the file header
+    static void set_file(const string & name);
+    static bool enabled() { return !file_name.empty(); }
+
+    // appends the block of a finished sweep; arr is its ranking view
+    static void write(const calc_time_mt_wrapper_struct & sweep, const vector<mem_array_rank> & arr);
+
+  private:
+    static string file_name;
+};
+
+#endif
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+# Filter and sort a design space dump written by cacti -dump (layout in
+# design_dump.h). The file is memory-mapped and its columns are read in
+# place, one block per partition sweep.
+#
+#   ./dump_query.py d.bin --blocks                  list the blocks
+#   ./dump_query.py d.bin --data --where 'access_time < 0.5e-9' \
+#       --sort read_energy --limit 10               ten cheapest fast enough
+#   ./dump_query.py d.bin --sort -area_efficiency --columns Ndwl,Ndbl,Nspd,area
+#
+# --where is a Python expression over the column names; rows are printed
+# as csv with the block's tech node, capacity and array kind in front.
+# Values are in s, J, W and um, as cacti computes them.
+
+import argparse
+import csv
+import mmap
+import struct
+import sys
+
+FILE_HEADER = struct.Struct('=8sIIII')
+COLUMN = struct.Struct('=24sc7x')
+BLOCK_HEADER = struct.Struct('=8sQQQQddIIIBBBB')
+WIRES = ['Global', 'Global_5', 'Global_10', 'Global_20', 'Global_30', 'Low_swing',
+         'Semi_global', 'Full_swing', 'Transmission', 'Optical']
+BLOCK_FIELDS = ['tech_nm', 'capacity', 'kind']
+
+
+class Block(object):
+    """One sweep: its header fields and a memoryview per column."""
+
+    def __init__(self, buf, pos, columns):
+        (magic, self.size, self.rows, self.enumerated, self.config_key, self.tech_nm,
+         self.capacity, self.block_sz, self.assoc, self.nbanks, self.is_tag,
+         self.pure_ram, self.pure_cam, self.fully_assoc) = BLOCK_HEADER.unpack_from(buf, pos)
+        if magic != b'CACTIBLK':
+            raise ValueError('no block at offset %d' % pos)
+        self.kind = 'tag' if self.is_tag else 'data'
+        self.columns = {}
+        pos += BLOCK_HEADER.size
+        for name, typ in columns:
+            width = 4 if typ == 'i' else 8
+            n = self.rows * width
+            self.columns[name] = buf[pos:pos + n].cast(typ)
+            pos += (n + 7) // 8 * 8
+
+
+def read_dump(buf):
+    """Column list and blocks of a mapped dump."""
+    magic, version, ncols, header_size, _ = FILE_HEADER.unpack_from(buf, 0)
+    if magic != b'CACTIDS1' or version != 1:
+        raise ValueError('not a cacti design space dump')
+    columns = []
+    for c in range(ncols):
+        name, typ = COLUMN.unpack_from(buf, FILE_HEADER.size + c * COLUMN.size)
+        columns.append((name.rstrip(b'\0').decode(), typ.decode()))
+    blocks = []
+    pos = header_size
+    while pos + BLOCK_HEADER.size <= len(buf):
+        b = Block(buf, pos, columns)
+        blocks.append(b)
+        pos += b.size
+    return [n for n, _ in columns], blocks
+
+
+def main():
+    ap = argparse.ArgumentParser(description='filter and sort a cacti design space dump')
+    ap.add_argument('dump', help='file written by cacti -dump')
+    ap.add_argument('--blocks', action='store_true', help='list the blocks instead of rows')
+    kind = ap.add_mutually_exclusive_group()
+    kind.add_argument('--tag', action='store_true', help='only tag array sweeps')
+    kind.add_argument('--data', action='store_true', help='only data array sweeps')
+    ap.add_argument('--where', help='Python expression a row has to satisfy')
+    ap.add_argument('--sort', help='column to sort by, -column for descending')
+    ap.add_argument('--limit', type=int, help='print at most this many rows')
+    ap.add_argument('--columns', help='comma separated columns to print (default: all)')
+    args = ap.parse_args()
+
+    with open(args.dump, 'rb') as f:
+        buf = memoryview(mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ))
+    names, blocks = read_dump(buf)
+    out = csv.writer(sys.stdout, lineterminator='\n')
+
+    if args.blocks:
+        out.writerow(['block', 'kind', 'tech_nm', 'capacity', 'block_sz', 'assoc', 'nbanks',
+                      'enumerated', 'rows', 'config_key'])
+        for i, b in enumerate(blocks):
+            out.writerow([i, b.kind, '%g' % b.tech_nm, '%g' % b.capacity, b.block_sz, b.assoc,
+                          b.nbanks, b.enumerated, b.rows, '%016x' % b.config_key])
+        return 0
+
+    shown = args.columns.split(',') if args.columns else names
+    key = args.sort.lstrip('-') if args.sort else None
+    for c in shown + ([key] if key else []):
+        if c not in names and c not in BLOCK_FIELDS:
+            ap.error('unknown column %s' % c)
+    where = compile(args.where, '--where', 'eval') if args.where else None
+
+    rows = []
+    for b in blocks:
+        if (args.tag and not b.is_tag) or (args.data and b.is_tag):
+            continue
+        cols = [b.columns[n] for n in names]
+        for i in range(b.rows):
+            row = dict((n, c[i]) for n, c in zip(names, cols))
+            row['tech_nm'], row['capacity'], row['kind'] = b.tech_nm, b.capacity, b.kind
+            if where is None or eval(where, {}, row):
+                rows.append(row)
+            # without sorting, rows can go out as soon as there are enough
+            if key is None and args.limit is not None and len(rows) >= args.limit:
+                break
+        if key is None and args.limit is not None and len(rows) >= args.limit:
+            break
+
+    if key:
+        rows.sort(key=lambda r: r[key], reverse=args.sort.startswith('-'))
+    if args.limit is not None:
+        rows = rows[:args.limit]
+
+    out.writerow(BLOCK_FIELDS + shown)
+    for r in rows:
+        out.writerow(['%g' % r['tech_nm'], '%g' % r['capacity'], r['kind']] +
+                     [WIRES[r[c]] if c == 'wire' and 0 <= r[c] < len(WIRES) else
+                      ('%.6g' % r[c] if isinstance(r[c], float) else r[c]) for c in shown])
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
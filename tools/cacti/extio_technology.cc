@@ -266,14 +266,14 @@ int IOTechParam::frequnecy_index(Mem_IO_type type)
 
 
 
-IOTechParam::IOTechParam(InputParameter * g_ip) 
+IOTechParam::IOTechParam(InputParameter * ip) 
 {
-  num_mem_ca  = g_ip->num_mem_dq * (g_ip->num_dq/g_ip->mem_data_width); 
-  num_mem_clk =  g_ip->num_mem_dq *
-                (g_ip->num_dq/g_ip->mem_data_width)/(g_ip->num_clk/2); 
+  num_mem_ca  = ip->num_mem_dq * (ip->num_dq/ip->mem_data_width); 
+  num_mem_clk =  ip->num_mem_dq *
+                (ip->num_dq/ip->mem_data_width)/(ip->num_clk/2); 
 
 
-  if (g_ip->io_type == LPDDR2) { //LPDDR
+  if (ip->io_type == LPDDR2) { //LPDDR
     //Technology Parameters
 
     vdd_io = 1.2;
@@ -354,16 +354,16 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
       * of experiments method shown in the technical report (), in Chapter 2.2. */
 
     k_noise_write_sen = k_noise_write * (1 + 0.2*(r_on/34 - 1) +
-        0.2*(g_ip->num_mem_dq/2 - 1));
+        0.2*(ip->num_mem_dq/2 - 1));
     k_noise_read_sen = k_noise_read * (1 + 0.2*(r_on/34 - 1) +
-        0.2*(g_ip->num_mem_dq/2 - 1));
+        0.2*(ip->num_mem_dq/2 - 1));
     k_noise_addr_sen = k_noise_addr * (1 + 0.1*(rtt_ca/100 - 1) +
         0.2*(r_on/34 - 1) + 0.2*(num_mem_ca/16 - 1));
 
     t_jitter_setup_sen = t_jitter_setup * (1  + 0.1*(r_on/34 - 1) +
-        0.3*(g_ip->num_mem_dq/2 - 1));
+        0.3*(ip->num_mem_dq/2 - 1));
     t_jitter_hold_sen = t_jitter_hold * (1 + 0.1*(r_on/34 - 1) +
-        0.3*(g_ip->num_mem_dq/2 - 1));
+        0.3*(ip->num_mem_dq/2 - 1));
     t_jitter_addr_setup_sen = t_jitter_addr_setup * (1 + 0.2*(rtt_ca/100 - 1) +
         0.1*(r_on/34 - 1) + 0.4*(num_mem_ca/16 - 1));
     t_jitter_addr_hold_sen = t_jitter_addr_hold * (1 + 0.2*(rtt_ca/100 - 1) +
@@ -404,7 +404,7 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
 
   }
-   else if (g_ip->io_type == WideIO) { //WIDEIO 
+   else if (ip->io_type == WideIO) { //WIDEIO 
      //Technology Parameters
      vdd_io = 1.2;
      v_sw_clk =  1.2;
@@ -483,17 +483,17 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
       * of experiments method shown in the technical report (), in Chapter 2.2. */
 
      k_noise_write_sen = k_noise_write * (1 + 0.2*(r_on/50 - 1) + 
-         0.2*(g_ip->num_mem_dq/2 - 1));
+         0.2*(ip->num_mem_dq/2 - 1));
      k_noise_read_sen = k_noise_read * (1 + 0.2*(r_on/50 - 1) + 
-         0.2*(g_ip->num_mem_dq/2 - 1));
+         0.2*(ip->num_mem_dq/2 - 1));
      k_noise_addr_sen = k_noise_addr * (1 + 0.2*(r_on/50 - 1) + 
          0.2*(num_mem_ca/16 - 1));
 
 
      t_jitter_setup_sen = t_jitter_setup * (1  + 0.1*(r_on/50 - 1) + 
-         0.3*(g_ip->num_mem_dq/2 - 1));
+         0.3*(ip->num_mem_dq/2 - 1));
      t_jitter_hold_sen = t_jitter_hold * (1 + 0.1*(r_on/50 - 1) + 
-         0.3*(g_ip->num_mem_dq/2 - 1));
+         0.3*(ip->num_mem_dq/2 - 1));
      t_jitter_addr_setup_sen = t_jitter_addr_setup * (1 + 0.1*(r_on/50 - 1) + 
          0.4*(num_mem_ca/16 - 1));
      t_jitter_addr_hold_sen = t_jitter_addr_hold * (1 + 0.1*(r_on/50 - 1) + 
@@ -531,7 +531,7 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
 
    }
-   else if (g_ip->io_type == DDR3)
+   else if (ip->io_type == DDR3)
    { //Default parameters for DDR3
      // IO Supply voltage (V) 
      vdd_io = 1.5;
@@ -575,18 +575,18 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
      //External IO Configuration Parameters 
 
      r_diff_term = 100;
-     rtt1_dq_read = g_ip->rtt_value; 
-     rtt2_dq_read = g_ip->rtt_value; 
-     rtt1_dq_write = g_ip->rtt_value;
-     rtt2_dq_write = g_ip->rtt_value; 
+     rtt1_dq_read = ip->rtt_value; 
+     rtt2_dq_read = ip->rtt_value; 
+     rtt1_dq_write = ip->rtt_value;
+     rtt2_dq_write = ip->rtt_value; 
      rtt_ca = 50; 
      rs1_dq = 15; 
      rs2_dq = 15; 
      r_stub_ca = 0; 
-     r_on = g_ip->ron_value; 
+     r_on = ip->ron_value; 
      r_on_ca = 50; 
      z0 = 50;
-     t_flight = g_ip->tflight_value;
+     t_flight = ip->tflight_value;
      t_flight_ca = 2;
 
      // Voltage noise coeffecients
@@ -614,11 +614,11 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
      k_noise_write_sen = k_noise_write * (1 + 0.1*(rtt1_dq_write/60 - 1) +
          0.2*(rtt2_dq_write/60 - 1) + 0.2*(r_on/34 - 1) +
-         0.2*(g_ip->num_mem_dq/2 - 1));
+         0.2*(ip->num_mem_dq/2 - 1));
 
      k_noise_read_sen = k_noise_read * (1 + 0.1*(rtt1_dq_read/60 - 1) +
          0.2*(rtt2_dq_read/60 - 1) + 0.2*(r_on/34 - 1) +
-         0.2*(g_ip->num_mem_dq/2 - 1));
+         0.2*(ip->num_mem_dq/2 - 1));
 
      k_noise_addr_sen = k_noise_addr * (1 + 0.1*(rtt_ca/50 - 1) +
          0.2*(r_on/34 - 1) + 0.2*(num_mem_ca/16 - 1));
@@ -626,11 +626,11 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
      t_jitter_setup_sen = t_jitter_setup * (1 + 0.2*(rtt1_dq_write/60 - 1) + 
          0.3*(rtt2_dq_write/60 - 1) + 0.1*(r_on/34 - 1) + 
-         0.3*(g_ip->num_mem_dq/2 - 1));
+         0.3*(ip->num_mem_dq/2 - 1));
 
      t_jitter_hold_sen = t_jitter_hold * (1 + 0.2*(rtt1_dq_write/60 - 1) + 
          0.3*(rtt2_dq_write/60 - 1) + 
-         0.1*(r_on/34 - 1) + 0.3*(g_ip->num_mem_dq/2 - 1));
+         0.1*(r_on/34 - 1) + 0.3*(ip->num_mem_dq/2 - 1));
 
      t_jitter_addr_setup_sen = t_jitter_addr_setup * (1 + 0.2*(rtt_ca/50 - 1) + 
          0.1*(r_on/34 - 1) + 0.4*(num_mem_ca/16 - 1));
@@ -669,7 +669,7 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
 
    }
-   else if (g_ip->io_type == DDR4)
+   else if (ip->io_type == DDR4)
    { //Default parameters for DDR4
      // IO Supply voltage (V) 
      vdd_io = 1.2;
@@ -713,18 +713,18 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
      //External IO Configuration Parameters 
 
      r_diff_term = 100;
-     rtt1_dq_read = g_ip->rtt_value; 
-     rtt2_dq_read = g_ip->rtt_value; 
-     rtt1_dq_write = g_ip->rtt_value;
-     rtt2_dq_write = g_ip->rtt_value; 
+     rtt1_dq_read = ip->rtt_value; 
+     rtt2_dq_read = ip->rtt_value; 
+     rtt1_dq_write = ip->rtt_value;
+     rtt2_dq_write = ip->rtt_value; 
      rtt_ca = 50; 
      rs1_dq = 15; 
      rs2_dq = 15; 
      r_stub_ca = 0; 
-     r_on = g_ip->ron_value; 
+     r_on = ip->ron_value; 
      r_on_ca = 50; 
      z0 = 50;
-     t_flight = g_ip->tflight_value;
+     t_flight = ip->tflight_value;
      t_flight_ca = 2;
 
      // Voltage noise coeffecients
@@ -752,11 +752,11 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
      k_noise_write_sen = k_noise_write * (1 + 0.1*(rtt1_dq_write/60 - 1) +
          0.2*(rtt2_dq_write/60 - 1) + 0.2*(r_on/34 - 1) +
-         0.2*(g_ip->num_mem_dq/2 - 1));
+         0.2*(ip->num_mem_dq/2 - 1));
 
      k_noise_read_sen = k_noise_read * (1 + 0.1*(rtt1_dq_read/60 - 1) +
          0.2*(rtt2_dq_read/60 - 1) + 0.2*(r_on/34 - 1) +
-         0.2*(g_ip->num_mem_dq/2 - 1));
+         0.2*(ip->num_mem_dq/2 - 1));
 
      k_noise_addr_sen = k_noise_addr * (1 + 0.1*(rtt_ca/50 - 1) +
          0.2*(r_on/34 - 1) + 0.2*(num_mem_ca/16 - 1));
@@ -764,11 +764,11 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
      t_jitter_setup_sen = t_jitter_setup * (1 + 0.2*(rtt1_dq_write/60 - 1) + 
          0.3*(rtt2_dq_write/60 - 1) + 0.1*(r_on/34 - 1) + 
-         0.3*(g_ip->num_mem_dq/2 - 1));
+         0.3*(ip->num_mem_dq/2 - 1));
 
      t_jitter_hold_sen = t_jitter_hold * (1 + 0.2*(rtt1_dq_write/60 - 1) + 
          0.3*(rtt2_dq_write/60 - 1) + 
-         0.1*(r_on/34 - 1) + 0.3*(g_ip->num_mem_dq/2 - 1));
+         0.1*(r_on/34 - 1) + 0.3*(ip->num_mem_dq/2 - 1));
 
      t_jitter_addr_setup_sen = t_jitter_addr_setup * (1 + 0.2*(rtt_ca/50 - 1) + 
          0.1*(r_on/34 - 1) + 0.4*(num_mem_ca/16 - 1));
@@ -807,7 +807,7 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
 
    }
-   else if (g_ip->io_type == Serial)
+   else if (ip->io_type == Serial)
    { //Default parameters for Serial
      // IO Supply voltage (V) 
      vdd_io = 1.2;
@@ -904,18 +904,18 @@ IOTechParam::IOTechParam(InputParameter * g_ip)
 
 }
 
-// This constructor recieves most of the input from g_ip.
+// This constructor recieves most of the input from ip.
 // however it is possible to customize other some of the paremeters,
 // that are mentioned as inputs.
 // connection: 0 bob-dimm, 1 host-dimm, 2 lrdimm
 
 
-IOTechParam::IOTechParam(InputParameter * g_ip, Mem_IO_type io_type1, int num_mem_dq, int mem_data_width
+IOTechParam::IOTechParam(InputParameter * ip, Mem_IO_type io_type1, int num_mem_dq, int mem_data_width
 						, int num_dq, int connection, int num_loads, double freq) 
 {
   num_mem_ca  = num_mem_dq * (mem_data_width); 
   num_mem_clk =  num_mem_dq *
-                (num_dq/mem_data_width)/(g_ip->num_clk/2); 
+                (num_dq/mem_data_width)/(ip->num_clk/2); 
 
   io_type = io_type1;
   frequency = freq;
@@ -1227,10 +1227,10 @@ IOTechParam::IOTechParam(InputParameter * g_ip, Mem_IO_type io_type1, int num_me
      r_diff_term = 100;
      
      /*
-     rtt1_dq_read = g_ip->rtt_value; 
-     rtt2_dq_read = g_ip->rtt_value; 
-     rtt1_dq_write = g_ip->rtt_value;
-     rtt2_dq_write = g_ip->rtt_value;
+     rtt1_dq_read = ip->rtt_value; 
+     rtt2_dq_read = ip->rtt_value; 
+     rtt1_dq_write = ip->rtt_value;
+     rtt2_dq_write = ip->rtt_value;
      */
      switch(connection)
      {
@@ -1261,10 +1261,10 @@ IOTechParam::IOTechParam(InputParameter * g_ip, Mem_IO_type io_type1, int num_me
      rs1_dq = 15; 
      rs2_dq = 15; 
      r_stub_ca = 0; 
-     r_on = g_ip->ron_value; 
+     r_on = ip->ron_value; 
      r_on_ca = 50; 
      z0 = 50;
-     t_flight = g_ip->tflight_value;
+     t_flight = ip->tflight_value;
      t_flight_ca = 2;
 
      // Voltage noise coeffecients
@@ -1392,10 +1392,10 @@ IOTechParam::IOTechParam(InputParameter * g_ip, Mem_IO_type io_type1, int num_me
 
      r_diff_term = 100;
      /*
-     rtt1_dq_read = g_ip->rtt_value; 
-     rtt2_dq_read = g_ip->rtt_value; 
-     rtt1_dq_write = g_ip->rtt_value;
-     rtt2_dq_write = g_ip->rtt_value; 
+     rtt1_dq_read = ip->rtt_value; 
+     rtt2_dq_read = ip->rtt_value; 
+     rtt1_dq_write = ip->rtt_value;
+     rtt2_dq_write = ip->rtt_value; 
      */
      
      switch(connection)
@@ -1426,10 +1426,10 @@ IOTechParam::IOTechParam(InputParameter * g_ip, Mem_IO_type io_type1, int num_me
      rs1_dq = 15; 
      rs2_dq = 15; 
      r_stub_ca = 0; 
-     r_on = g_ip->ron_value; 
+     r_on = ip->ron_value; 
      r_on_ca = 50; 
      z0 = 50;
-     t_flight = g_ip->tflight_value;
+     t_flight = ip->tflight_value;
      t_flight_ca = 2;
 
      // Voltage noise coeffecients
@@ -35,6 +35,17 @@
 #include "wire.h"
 #include <assert.h>
 #include <iostream>
+#include <map>
+#include <pthread.h>
+
+
+// Networks already built, keyed by cache_key(). A network only depends on
+// the wire models and on its geometry, so banks and arrays of the same
+// shape share one, also between the tag and the data array of a solve.
+#define HTREE_CACHE_MAX_ENTRIES 16384
+
+static pthread_mutex_t htree_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static map<vector<double>, Htree2> htree_cache;
 
 Htree2::Htree2(
     enum Wire_type wire_model, double mat_w, double mat_h,
@@ -60,6 +71,25 @@ Htree2::Htree2(
 //  if (ndwl == 1) ndwl++;
 //  if (ndbl == 1) ndbl++;
 
+  vector<double> key;
+  bool shared = cache_key(key);
+  if (shared)
+  {
+    pthread_mutex_lock(&htree_cache_lock);
+    map<vector<double>, Htree2>::const_iterator it = htree_cache.find(key);
+    bool found = (it != htree_cache.end());
+    if (found)
+    {
+      *this = it->second;
+      deviceType = dt;
+    }
+    pthread_mutex_unlock(&htree_cache_lock);
+    if (found)
+    {
+      return;
+    }
+  }
+
   max_unpipelined_link_delay = 0; //TODO
   min_w_nmos = g_tp.min_w_nmos_;
   min_w_pmos = deviceType->n_to_p_eff_curr_drv_ratio * min_w_nmos;
@@ -96,6 +126,47 @@ Htree2::Htree2(
 
   assert(power.readOp.dynamic >= 0);
   assert(power.readOp.leakage >= 0);
+
+  if (shared)
+  {
+    pthread_mutex_lock(&htree_cache_lock);
+    if (htree_cache.size() >= HTREE_CACHE_MAX_ENTRIES)
+    {
+      htree_cache.clear();
+    }
+    htree_cache.insert(make_pair(key, *this));
+    pthread_mutex_unlock(&htree_cache_lock);
+  }
+}
+
+
+
+// false when the wire models of this solve are not shared either
+bool Htree2::cache_key(vector<double> & key)
+{
+  long dt_offset = (char *) deviceType - (char *) &g_tp;
+  if (g_ctx->wire->key.empty() || dt_offset < 0 ||
+      dt_offset >= (long) sizeof(TechnologyParameter))
+  {
+    return false;
+  }
+
+  key = g_ctx->wire->key;
+  key.push_back(dt_offset);
+  key.push_back(wt);
+  key.push_back(tree_type);
+  key.push_back(mat_width);
+  key.push_back(mat_height);
+  key.push_back(add_bits);
+  key.push_back(data_in_bits);
+  key.push_back(search_data_in_bits);
+  key.push_back(data_out_bits);
+  key.push_back(search_data_out_bits);
+  key.push_back(ndbl);
+  key.push_back(ndwl);
+  key.push_back(uca_tree);
+  key.push_back(search_tree);
+  return true;
 }
 
 
@@ -235,6 +306,60 @@ void Htree2::output_buffer(double s1, double s2, double l_eff)
 
 
 
+void Htree2::wire_bounds(
+    enum Wire_type wire_model, double mat_w, double mat_h, int bits, int bl, int wl,
+    double & delay, double & energy)
+{
+  delay  = 0;
+  energy = 0;
+
+  if (wire_model != Global && wire_model != Global_5 && wire_model != Global_10 &&
+      wire_model != Global_20 && wire_model != Global_30)
+  {
+    return;
+  }
+
+  // the same links as in_htree() and out_htree(), from the mats alone
+  int h = (int) _log2(wl/2);
+  int v = (int) _log2(bl/2);
+  double len = mat_w * wl / 4;
+  double ht  = mat_h * bl / 8;
+  double wire_len = 0;
+
+  while (v > 0 || h > 0)
+  {
+    if (h > v)
+    {
+      wire_len += len;
+      len /= 2;
+      h--;
+    }
+    else if (v > 0 && h > 0)
+    {
+      wire_len += len + ht;
+      len /= 2;
+      ht  /= 2;
+      v--;
+      h--;
+    }
+    else
+    {
+      wire_len += ht;
+      ht /= 2;
+      v--;
+    }
+  }
+
+  if (wire_len > 0)
+  {
+    Wire unit(wire_model, 1);
+    delay  = unit.delay * wire_len;
+    energy = unit.power.readOp.dynamic * wire_len * bits;
+  }
+}
+
+
+
 /* calculates the input h-tree delay/power
  * A nand gate is used at each node to
  * limit the signal
@@ -72,6 +72,13 @@ class Htree2 : public Component
     double max_unpipelined_link_delay;
     powerDef power_bit;
 
+    // Lower bounds on the delay and read energy of a tree of bits wires over
+    // bl/2 x wl/2 mats of at least mat_w x mat_h: its links alone, without
+    // the wiring it adds between the mats or the buffers at its nodes.
+    // Both are 0 for wire models whose cost is not linear in their length.
+    static void wire_bounds(enum Wire_type wire_model, double mat_w, double mat_h, int bits, int bl, int wl,
+                            double & delay, double & energy);
+
 
   private:
     double wire_bw;
@@ -92,6 +99,7 @@ class Htree2 : public Component
 
     /*TechnologyParameter::*/DeviceType *deviceType;
 
+    bool cache_key(vector<double> & key);
 };
 
 #endif
@@ -34,6 +34,7 @@
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <cstring>
 
 
 #include "io.h"
@@ -52,30 +53,25 @@
 #include "extio.h"
 #include "extio_technology.h"
 #include "memcad.h"
+#include "thread_pool.h"
+#include "profile.h"
 
 using namespace std;
 
 
 InputParameter::InputParameter()
-:  array_power_gated(false),
- bitline_floating(false),
- wl_power_gated(false),
- cl_power_gated(false),
- interconect_power_gated(false),
- power_gating(false),
- cl_vertical (true)
 {
-
+  // all members are plain data and parse_cfg() leaves many of them alone,
+  // so start from zero rather than from whatever the heap hands back.
+  memset(this, 0, sizeof(*this));
+  cl_vertical = true;
 }
 
-/* Parses "cache.cfg" file */
-  void
-InputParameter::parse_cfg(const string & in_file)
+/* Reads the lines of a "cache.cfg" file */
+void read_cfg_lines(const string & in_file, vector<string> & lines)
 {
   FILE *fp = fopen(in_file.c_str(), "r");
   char line[5000];
-  char jk[5000];
-  char temp_var[5000];
 
   if(!fp) {
     cout << in_file << " is missing!\n";
@@ -83,11 +79,36 @@ InputParameter::parse_cfg(const string & in_file)
   }
 
   while(fscanf(fp, "%[^\n]\n", line) != EOF) {
+    lines.push_back(line);
+  }
+  fclose(fp);
+}
+
+/* Parses "cache.cfg" file */
+  void
+InputParameter::parse_cfg(const string & in_file)
+{
+  vector<string> lines;
+  read_cfg_lines(in_file, lines);
+  parse_cfg(lines);
+}
+
+/* Parses config lines; later lines override earlier ones */
+  void
+InputParameter::parse_cfg(const vector<string> & lines)
+{
+  char line[5000];
+  char jk[5000];
+  char temp_var[5000];
+
+  for (unsigned int l = 0; l < lines.size(); l++) {
+    strncpy(line, lines[l].c_str(), sizeof(line) - 1);
+    line[sizeof(line) - 1] = '\0';
 
     if (!strncmp("-size", line, strlen("-size"))) {
       sscanf(line, "-size %[(:-~)*]%u", jk, &(cache_sz));
-      if (g_ip->print_detail_debug)
-          	cout << "cache size: " << g_ip->cache_sz << "GB" << endl;
+      if (print_detail_debug)
+          	cout << "cache size: " << cache_sz << "GB" << endl;
       continue;
     }
 
@@ -192,7 +213,7 @@ InputParameter::parse_cfg(const string & in_file)
     	  //is_main_mem = false;
       }
 
-	  if (g_ip->print_detail_debug)
+	  if (print_detail_debug)
 	  {cout << "io.cc: is_3d_mem = " << is_3d_mem << endl;}
 
       if (!strncmp("cam", temp_var, sizeof("cam"))) {
@@ -224,7 +245,7 @@ InputParameter::parse_cfg(const string & in_file)
     	else {
     		print_detail_debug = false;
     	}
-    	if (g_ip->print_detail_debug)
+    	if (print_detail_debug)
     	{cout << "io.cc: print_detail_debug = " << print_detail_debug << endl;}
     	continue;
     }
@@ -241,8 +262,8 @@ InputParameter::parse_cfg(const string & in_file)
 
     if (!strncmp("-system frequency", line, strlen("-system frequency"))) {
       sscanf(line, "-system frequency %[(:-~)*]%u", jk, &(sys_freq_MHz));
-      if(g_ip->print_detail_debug)
-    	  cout << "system frequency: " << g_ip->sys_freq_MHz  << endl;
+      if(print_detail_debug)
+    	  cout << "system frequency: " << sys_freq_MHz  << endl;
       continue;
     }
 
@@ -250,34 +271,34 @@ InputParameter::parse_cfg(const string & in_file)
 
     if (!strncmp("-stacked die", line, strlen("-stacked die"))) {
       sscanf(line, "-stacked die %[(:-~)*]%u", jk, &(num_die_3d));
-      if(g_ip->print_detail_debug)
-    	  cout << "num_die_3d: " << g_ip->num_die_3d  << endl;
+      if(print_detail_debug)
+    	  cout << "num_die_3d: " << num_die_3d  << endl;
       continue;
     }
 
     if (!strncmp("-partitioning granularity", line, strlen("-partitioning granularity"))) {
       sscanf(line, "-partitioning %[(:-~)*]%u", jk, &(partition_gran));
-      if(g_ip->print_detail_debug)
-    	  cout << "partitioning granularity: " << g_ip->partition_gran  << endl;
+      if(print_detail_debug)
+    	  cout << "partitioning granularity: " << partition_gran  << endl;
       continue;
     }
 
     if (!strncmp("-TSV projection", line, strlen("-TSV projection"))) {
         sscanf(line, "-TSV %[(:-~)*]%u", jk, &(TSV_proj_type));
-        if(g_ip->print_detail_debug)
-        	cout << "TSV projection: " << g_ip->TSV_proj_type  << endl;
+        if(print_detail_debug)
+        	cout << "TSV projection: " << TSV_proj_type  << endl;
         continue;
     }
 
 
-    //g_ip->print_detail_debug = debug_detail;
+    //print_detail_debug = debug_detail;
 
 
-    //g_ip->partition_gran = 1;
+    //partition_gran = 1;
 
     // --- These two parameters are supposed for bank level partitioning, currently not shown to public
-    g_ip->num_tier_row_sprd = 1;
-    g_ip->num_tier_col_sprd = 1;
+    num_tier_row_sprd = 1;
+    num_tier_col_sprd = 1;
 
     if (!strncmp("-tag size", line, strlen("-tag size"))) {
       sscanf(line, "-tag size%[^\"]\"%[^\"]\"", jk, temp_var);
@@ -847,6 +868,15 @@ InputParameter::parse_cfg(const string & in_file)
     if(!strncmp("-mem_data_width", line, strlen("-mem_data_width"))) {
       sscanf(line, "-mem_data_width %d", &mem_data_width);
     }
+    if(!strncmp("-rtt_value", line, strlen("-rtt_value"))) {
+      sscanf(line, "-rtt_value %lf", &rtt_value);
+    }
+    if(!strncmp("-ron_value", line, strlen("-ron_value"))) {
+      sscanf(line, "-ron_value %lf", &ron_value);
+    }
+    if(!strncmp("-tflight_value", line, strlen("-tflight_value"))) {
+      sscanf(line, "-tflight_value %lf", &tflight_value);
+    }
 	
 	// added just for memcad
 	
@@ -1047,7 +1077,6 @@ InputParameter::parse_cfg(const string & in_file)
 	
   }
   rpters_in_htree = true;
-  fclose(fp);
 }
 
   void
@@ -1117,16 +1146,16 @@ InputParameter::display_ip()
   cout << "Page size                     : " << page_sz_bits << endl;
   cout << "Burst length                  : " << burst_len << endl;
   cout << "Internal prefetch width       : " << int_prefetch_w << endl;
-  cout << "Force cache config            : " << g_ip->force_cache_config << endl;
-  if (g_ip->force_cache_config) {
-    cout << "Ndwl                          : " << g_ip->ndwl << endl;
-    cout << "Ndbl                          : " << g_ip->ndbl << endl;
-    cout << "Nspd                          : " << g_ip->nspd << endl;
-    cout << "Ndcm                          : " << g_ip->ndcm << endl;
-    cout << "Ndsam1                        : " << g_ip->ndsam1 << endl;
-    cout << "Ndsam2                        : " << g_ip->ndsam2 << endl;
+  cout << "Force cache config            : " << force_cache_config << endl;
+  if (force_cache_config) {
+    cout << "Ndwl                          : " << ndwl << endl;
+    cout << "Ndbl                          : " << ndbl << endl;
+    cout << "Nspd                          : " << nspd << endl;
+    cout << "Ndcm                          : " << ndcm << endl;
+    cout << "Ndsam1                        : " << ndsam1 << endl;
+    cout << "Ndsam2                        : " << ndsam2 << endl;
   }
-  cout << "Subarray Driver direction       : " << g_ip->cl_vertical << endl;
+  cout << "Subarray Driver direction       : " << cl_vertical << endl;
 
  // CACTI-I/O
   cout << "iostate                       : " ;
@@ -1244,11 +1273,14 @@ uca_org_t cacti_interface(const string & infile_name)
   // --- These two parameters are supposed for two different TSV technologies within one DRAM fabrication, currently assume one individual TSV geometry size for cost efficiency
   g_ip->tsv_is_subarray_type = g_ip->TSV_proj_type;
   g_ip->tsv_os_bank_type = g_ip->TSV_proj_type;
+  {
+  ProfilePhase prof(PROF_TSV_EXTIO);
   TSV tsv_test(Coarse);// ********* double len_ /* in um*/, 	double diam_, 	double TSV_pitch_,
   if(g_ip->print_detail_debug)
   {
 	  tsv_test.print_TSV();
   }
+  }
 
 //  For HighRadix Only
 //  ////  Wire wirea(g_ip->wt, 1000);
@@ -1281,6 +1313,7 @@ uca_org_t cacti_interface(const string & infile_name)
 
   if (g_ip->nuca == 1)
   {
+    ProfilePhase prof(PROF_NUCA);
     Nuca n(&g_tp.peri_global);
     n.sim_nuca();
   }
@@ -1288,7 +1321,8 @@ uca_org_t cacti_interface(const string & infile_name)
   //g_ip->display_ip();
 	
 	
-   
+  {
+  ProfilePhase prof(PROF_TSV_EXTIO);
   IOTechParam iot(g_ip, g_ip->io_type, g_ip->num_mem_dq, g_ip->mem_data_width, g_ip->num_dq,g_ip->dram_dimm, 1,g_ip->bus_freq ); 
   Extio testextio(&iot);  
   testextio.extio_area();
@@ -1296,6 +1330,7 @@ uca_org_t cacti_interface(const string & infile_name)
   testextio.extio_power_dynamic();
   testextio.extio_power_phy();
   testextio.extio_power_term();	   
+  }
   
  
   /*
@@ -1335,13 +1370,19 @@ uca_org_t cacti_interface(const string & infile_name)
   
   solve(&fin_res);
 
+  {
+  ProfilePhase prof(PROF_OUTPUT);
   output_UCA(&fin_res);
   output_data_csv(fin_res, infile_name + ".out");
+  }
 
 
   // Memcad Optimization
+  {
+  ProfilePhase prof(PROF_MEMCAD);
   MemCadParameters memcad_params(g_ip);
   solve_memcad(&memcad_params);
+  }
 
 
   delete (g_ip);
@@ -1967,7 +2008,7 @@ bool InputParameter::error_checking()
 
   if(is_main_mem)
   {
-	if(ic_proj_type == 0 && !g_ip->is_3d_mem)
+	if(ic_proj_type == 0 && !is_3d_mem)
     {
       cerr << "DRAM model supports only conservative interconnect projection!\n\n";
       return false;
@@ -2043,7 +2084,7 @@ bool InputParameter::error_checking()
   }
 
   int C = cache_sz/nbanks;
-  if (C < 64 && !g_ip->is_3d_mem)
+  if (C < 64 && !is_3d_mem)
   {
     cerr << "Cache size must >=64" << endl;
     return false;
@@ -2137,7 +2178,7 @@ bool InputParameter::error_checking()
     }
   }
 
-  if (C/(B*A) <= 1 && assoc!=0 && !g_ip->is_3d_mem)
+  if (C/(B*A) <= 1 && assoc!=0 && !is_3d_mem)
   {
     cerr << "Number of sets is too small: " << endl;
     cerr << " Need to either increase cache size, or decrease associativity or block size" << endl;
@@ -2179,7 +2220,7 @@ bool InputParameter::error_checking()
     return false;
   }
 
-  if (nsets < 1 && !g_ip->is_3d_mem)
+  if (nsets < 1 && !is_3d_mem)
   {
     cerr << "Less than one set..." << endl;
     return false;
@@ -2529,29 +2570,16 @@ void output_data_csv_3dd(const uca_org_t & fin_res)
   file.close();
 }
 
-void output_data_csv(const uca_org_t & fin_res, string fn)
+// Column names of the csv summary, one line.
+void output_data_csv_header(ostream & file)
 {
-  //TODO: the csv output should remain
-  fstream file(fn.c_str(), ios::in);
-  bool    print_index = file.fail();
-  file.close();
-
-  file.open(fn.c_str(), ios::out|ios::app);
-  if (file.fail() == true)
-  {
-    cerr << "File out.csv could not be opened successfully" << endl;
-  }
-  else
-  {
-    if (print_index == true)
-    {
-      file << "Tech node (nm), ";
-      file << "Capacity (bytes), ";
-      file << "Number of banks, ";
-      file << "Associativity, ";
-      file << "Output width (bits), ";
-      file << "Access time (ns), ";
-      file << "Random cycle time (ns), ";
+  file << "Tech node (nm), ";
+  file << "Capacity (bytes), ";
+  file << "Number of banks, ";
+  file << "Associativity, ";
+  file << "Output width (bits), ";
+  file << "Access time (ns), ";
+  file << "Random cycle time (ns), ";
 //      file << "Multisubbank interleave cycle time (ns), ";
 
 //      file << "Delay request network (ns), ";
@@ -2561,31 +2589,31 @@ void output_data_csv(const uca_org_t & fin_res, string fn)
 //      file << "Data array access time (ns), ";
 //      file << "Refresh period (microsec), ";
 //      file << "DRAM array availability (%), ";
-      file << "Dynamic search energy (nJ), ";
-      file << "Dynamic read energy (nJ), ";
-      file << "Dynamic write energy (nJ), ";
+  file << "Dynamic search energy (nJ), ";
+  file << "Dynamic read energy (nJ), ";
+  file << "Dynamic write energy (nJ), ";
 //      file << "Tag Dynamic read energy (nJ), ";
 //      file << "Data Dynamic read energy (nJ), ";
 //      file << "Dynamic read power (mW), ";
-      file << "Standby leakage per bank(mW), ";
+  file << "Standby leakage per bank(mW), ";
 //      file << "Leakage per bank with leak power management (mW), ";
 //      file << "Leakage per bank with leak power management (mW), ";
 //      file << "Refresh power as percentage of standby leakage, ";
-      file << "Area (mm2), ";
-      file << "Ndwl, ";
-      file << "Ndbl, ";
-      file << "Nspd, ";
-      file << "Ndcm, ";
-      file << "Ndsam_level_1, ";
-      file << "Ndsam_level_2, ";
-      file << "Data arrary area efficiency %, ";
-      file << "Ntwl, ";
-      file << "Ntbl, ";
-      file << "Ntspd, ";
-      file << "Ntcm, ";
-      file << "Ntsam_level_1, ";
-      file << "Ntsam_level_2, ";
-      file << "Tag arrary area efficiency %, ";
+  file << "Area (mm2), ";
+  file << "Ndwl, ";
+  file << "Ndbl, ";
+  file << "Nspd, ";
+  file << "Ndcm, ";
+  file << "Ndsam_level_1, ";
+  file << "Ndsam_level_2, ";
+  file << "Data arrary area efficiency %, ";
+  file << "Ntwl, ";
+  file << "Ntbl, ";
+  file << "Ntspd, ";
+  file << "Ntcm, ";
+  file << "Ntsam_level_1, ";
+  file << "Ntsam_level_2, ";
+  file << "Tag arrary area efficiency %, ";
 
 //      file << "Resistance per unit micron (ohm-micron), ";
 //      file << "Capacitance per unit micron (fF per micron), ";
@@ -2614,15 +2642,19 @@ void output_data_csv(const uca_org_t & fin_res, string fn)
 //      file << "Delay opt (perc), ";
 //      file << "Repeater opt (perc), ";
 //      file << "Aspect ratio";
-      file << endl;
-    }
-    file << g_ip->F_sz_nm << ", ";
-    file << g_ip->cache_sz << ", ";
-    file << g_ip->nbanks << ", ";
-    file << g_ip->tag_assoc << ", ";
-    file << g_ip->out_w << ", ";
-    file << fin_res.access_time*1e+9 << ", ";
-    file << fin_res.cycle_time*1e+9 << ", ";
+  file << endl;
+}
+
+// One csv summary line for fin_res, solved with the bound g_ip.
+void output_data_csv_row(ostream & file, const uca_org_t & fin_res)
+{
+  file << g_ip->F_sz_nm << ", ";
+  file << g_ip->cache_sz << ", ";
+  file << g_ip->nbanks << ", ";
+  file << g_ip->tag_assoc << ", ";
+  file << g_ip->out_w << ", ";
+  file << fin_res.access_time*1e+9 << ", ";
+  file << fin_res.cycle_time*1e+9 << ", ";
 //    file << fin_res.data_array2->multisubbank_interleave_cycle_time*1e+9 << ", ";
 //    file << fin_res.data_array2->delay_request_network*1e+9 << ", ";
 //    file << fin_res.data_array2->delay_inside_mat*1e+9 <<  ", ";
@@ -2639,16 +2671,16 @@ void output_data_csv(const uca_org_t & fin_res, string fn)
 //    file << fin_res.data_array2->access_time*1e+9 << ", ";
 //    file << fin_res.data_array2->dram_refresh_period*1e+6 << ", ";
 //    file << fin_res.data_array2->dram_array_availability <<  ", ";
-    if (g_ip->fully_assoc || g_ip->pure_cam)
-    {
-    	file << fin_res.power.searchOp.dynamic*1e+9 << ", ";
-    }
-    	else
-    {
-    		file << "N/A" << ", ";
-    }
-    file << fin_res.power.readOp.dynamic*1e+9 << ", ";
-    file << fin_res.power.writeOp.dynamic*1e+9 << ", ";
+  if (g_ip->fully_assoc || g_ip->pure_cam)
+  {
+  	file << fin_res.power.searchOp.dynamic*1e+9 << ", ";
+  }
+  	else
+  {
+  		file << "N/A" << ", ";
+  }
+  file << fin_res.power.readOp.dynamic*1e+9 << ", ";
+  file << fin_res.power.writeOp.dynamic*1e+9 << ", ";
 //    if (!(g_ip->fully_assoc || g_ip->pure_cam || g_ip->pure_ram))
 //        {
 //        	file << fin_res.tag_array2->power.readOp.dynamic*1e+9 << ", ";
@@ -2667,38 +2699,38 @@ void output_data_csv(const uca_org_t & fin_res, string fn)
 //        	file << fin_res.power.readOp.dynamic*1000/fin_res.cycle_time << ", ";
 //        }
 
-    file <<( fin_res.power.readOp.leakage + fin_res.power.readOp.gate_leakage )*1000 << ", ";
+  file <<( fin_res.power.readOp.leakage + fin_res.power.readOp.gate_leakage )*1000 << ", ";
 //    file << fin_res.leak_power_with_sleep_transistors_in_mats*1000 << ", ";
 //    file << fin_res.data_array.refresh_power / fin_res.data_array.total_power.readOp.leakage << ", ";
-    file << fin_res.area*1e-6 << ", ";
-
-    file << fin_res.data_array2->Ndwl << ", ";
-    file << fin_res.data_array2->Ndbl << ", ";
-    file << fin_res.data_array2->Nspd << ", ";
-    file << fin_res.data_array2->deg_bl_muxing << ", ";
-    file << fin_res.data_array2->Ndsam_lev_1 << ", ";
-    file << fin_res.data_array2->Ndsam_lev_2 << ", ";
-    file << fin_res.data_array2->area_efficiency << ", ";
-    if (!(g_ip->fully_assoc || g_ip->pure_cam || g_ip->pure_ram))
-    {
-    file << fin_res.tag_array2->Ndwl << ", ";
-    file << fin_res.tag_array2->Ndbl << ", ";
-    file << fin_res.tag_array2->Nspd << ", ";
-    file << fin_res.tag_array2->deg_bl_muxing << ", ";
-    file << fin_res.tag_array2->Ndsam_lev_1 << ", ";
-    file << fin_res.tag_array2->Ndsam_lev_2 << ", ";
-    file << fin_res.tag_array2->area_efficiency << ", ";
-    }
-    else
-    {
-    	file << "N/A" << ", ";
-    	file << "N/A"<< ", ";
-    	file << "N/A" << ", ";
-    	file << "N/A" << ", ";
-    	file << "N/A" << ", ";
-    	file << "N/A" << ", ";
-    	file << "N/A" << ", ";
-    }
+  file << fin_res.area*1e-6 << ", ";
+
+  file << fin_res.data_array2->Ndwl << ", ";
+  file << fin_res.data_array2->Ndbl << ", ";
+  file << fin_res.data_array2->Nspd << ", ";
+  file << fin_res.data_array2->deg_bl_muxing << ", ";
+  file << fin_res.data_array2->Ndsam_lev_1 << ", ";
+  file << fin_res.data_array2->Ndsam_lev_2 << ", ";
+  file << fin_res.data_array2->area_efficiency << ", ";
+  if (!(g_ip->fully_assoc || g_ip->pure_cam || g_ip->pure_ram))
+  {
+  file << fin_res.tag_array2->Ndwl << ", ";
+  file << fin_res.tag_array2->Ndbl << ", ";
+  file << fin_res.tag_array2->Nspd << ", ";
+  file << fin_res.tag_array2->deg_bl_muxing << ", ";
+  file << fin_res.tag_array2->Ndsam_lev_1 << ", ";
+  file << fin_res.tag_array2->Ndsam_lev_2 << ", ";
+  file << fin_res.tag_array2->area_efficiency << ", ";
+  }
+  else
+  {
+  	file << "N/A" << ", ";
+  	file << "N/A"<< ", ";
+  	file << "N/A" << ", ";
+  	file << "N/A" << ", ";
+  	file << "N/A" << ", ";
+  	file << "N/A" << ", ";
+  	file << "N/A" << ", ";
+  }
 
 //    file << g_tp.wire_inside_mat.R_per_um << ", ";
 //    file << g_tp.wire_inside_mat.C_per_um / 1e-15 << ", ";
@@ -2721,7 +2753,28 @@ void output_data_csv(const uca_org_t & fin_res, string fn)
 //    file << fin_res.data_array.cas_latency * 1e9 << ", " ;
 //    file << fin_res.data_array.precharge_delay * 1e9 << ", " ;
 //    file << fin_res.data_array.all_banks_height / fin_res.data_array.all_banks_width;
-    file<<endl;
+  file<<endl;
+}
+
+void output_data_csv(const uca_org_t & fin_res, string fn)
+{
+  //TODO: the csv output should remain
+  fstream file(fn.c_str(), ios::in);
+  bool    print_index = file.fail();
+  file.close();
+
+  file.open(fn.c_str(), ios::out|ios::app);
+  if (file.fail() == true)
+  {
+    cerr << "File out.csv could not be opened successfully" << endl;
+  }
+  else
+  {
+    if (print_index == true)
+    {
+      output_data_csv_header(file);
+    }
+    output_data_csv_row(file, fin_res);
   }
   file.close();
 }
@@ -3640,6 +3693,36 @@ uca_org_t cacti_interface(InputParameter  * const local_interface)
 }
 
 //McPAT's plain interface, please keep !!!
+uca_org_t cacti_interface(SolverContext * ctx, InputParameter * const local_interface)
+{
+  SolverContext * prev = ctx->bind();
+  uca_org_t fin_res = cacti_interface(local_interface);
+  prev->bind();
+  return fin_res;
+}
+
+struct cacti_interface_mt_struct
+{
+  const vector<InputParameter *> * configs;
+  vector<uca_org_t> * results;
+};
+
+void cacti_interface_mt(void * void_obj, uint64_t idx, uint32_t slot)
+{
+  cacti_interface_mt_struct * obj = (cacti_interface_mt_struct *) void_obj;
+  SolverContext ctx;
+  (*obj->results)[idx] = cacti_interface(&ctx, (*obj->configs)[idx]);
+}
+
+void cacti_interface(const vector<InputParameter *> & configs, vector<uca_org_t> & results)
+{
+  cacti_interface_mt_struct obj;
+  results.resize(configs.size());
+  obj.configs = &configs;
+  obj.results = &results;
+  ThreadPool::instance().parallel_for(configs.size(), cacti_interface_mt, (void *) &obj);
+}
+
 uca_org_t init_interface(InputParameter* const local_interface)
 {
  // g_ip = new InputParameter();
@@ -3788,3 +3871,32 @@ void reconfigure(InputParameter *local_interface, uca_org_t *fin_res)
   update(fin_res);
 }
 
+// Same as cacti_interface(local_interface), but only the objective weights,
+// deviation limits and ed may differ from the last call on this thread's
+// context; the sweep results of that call are ranked again instead of being
+// recomputed. fin_res.valid is false if the other inputs differ.
+uca_org_t rerank_interface(InputParameter * const local_interface)
+{
+  uca_org_t fin_res;
+  fin_res.valid = false;
+
+  g_ip = local_interface;
+  g_ip->error_checking();
+
+  init_tech_params(g_ip->F_sz_um, false);
+  Wire winit; // Do not delete this line. It initializes wires.
+
+  rerank_solve(&fin_res);
+
+  return fin_res;
+}
+
+bool temperature_sweep(InputParameter * const local_interface, const uca_org_t & fin_res,
+    const vector<unsigned int> & temps, vector<uca_temp_power_t> & res)
+{
+  g_ip = local_interface;
+  g_ip->error_checking();
+
+  return sweep_temperature(fin_res, temps, res);
+}
+
@@ -38,7 +38,10 @@
 #include "cacti_interface.h"
 
 
+void read_cfg_lines(const string & in_file, vector<string> & lines);
 void output_data_csv(const uca_org_t & fin_res, string fn="out.csv");
+void output_data_csv_header(ostream & file);
+void output_data_csv_row(ostream & file, const uca_org_t & fin_res);
 void output_UCA(uca_org_t * fin_res);
 void output_data_csv_3dd(const uca_org_t & fin_res);
 
@@ -43,6 +43,13 @@
 #include <iostream>
 
 #include "Ucache.h"
+#include "thread_pool.h"
+#include "sweep.h"
+#include "partition_memo.h"
+#include "pareto.h"
+#include "design_dump.h"
+#include "profile.h"
+#include "server.h"
 
 using namespace std;
 
@@ -55,6 +62,9 @@ int main(int argc,char *argv[])
   {
     bool infile_specified = false;
     string infile_name("");
+    string sweep_name("");
+    string socket_name("");
+    bool profile = false;
 
     for (int32_t i = 0; i < argc; i++)
     {
@@ -64,15 +74,69 @@ int main(int argc,char *argv[])
         i++;
         infile_name = argv[i];
       }
+      else if (argv[i] == string("-threads") && i + 1 < argc)
+      {
+        i++;
+        ThreadPool::set_size(atoi(argv[i]));
+      }
+      else if (argv[i] == string("-prune"))
+      {
+        set_partition_pruning(true);
+      }
+      else if (argv[i] == string("-memo") && i + 1 < argc)
+      {
+        i++;
+        PartitionMemo::set_dir(argv[i]);
+      }
+      else if (argv[i] == string("-pareto") && i + 1 < argc)
+      {
+        i++;
+        ParetoFront::set_file(argv[i]);
+      }
+      else if (argv[i] == string("-dump") && i + 1 < argc)
+      {
+        i++;
+        DesignDump::set_file(argv[i]);
+      }
+      else if (argv[i] == string("-profile"))
+      {
+        profile = true;
+      }
+      else if (argv[i] == string("-sweep") && i + 1 < argc)
+      {
+        i++;
+        sweep_name = argv[i];
+      }
+      else if (argv[i] == string("-serve") && i + 1 < argc)
+      {
+        i++;
+        socket_name = argv[i];
+      }
     }
     if (infile_specified == false)
     {
       cerr << " Invalid arguments -- how to use CACTI:" << endl;
-      cerr << "  1) cacti -infile <input file name>" << endl;
+      cerr << "  1) cacti -infile <input file name> [-threads <count>] [-prune] [-memo <dir>] [-pareto <csv file>] [-dump <file>] [-sweep <sweep file>] [-serve <socket>] [-profile]" << endl;
       cerr << "  2) cacti arg1 ... arg52 -- please refer to the README file" << endl;
       cerr << " No. of arguments input - " << argc << endl;
       exit(1);
     }
+
+    if (profile)
+    {
+      Profiler::enable(((sweep_name != "") ? sweep_name : infile_name) + ".profile.json");
+    }
+
+    if (socket_name != "")
+    {
+      serve_interface(infile_name, socket_name);
+      return 0;
+    }
+    else if (sweep_name != "")
+    {
+      sweep_interface(infile_name, sweep_name);
+      return 0;
+    }
     else
     {
       result = cacti_interface(infile_name);
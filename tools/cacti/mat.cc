@@ -1286,6 +1286,110 @@ double Mat::compute_bitline_delay(double inrisetime)
 
 
 
+// Mirrors the bitline and sense amplifier models of compute_bitline_delay()
+// and compute_sa_delay(). The bitline delay is at least tstep whatever the
+// wordline rise time; the row path and the read energy only add to these.
+// The mat adds its peripheral circuits to the subarrays (see Mat::Mat()).
+void Mat::bitline_bounds(const DynamicParameter & dyn_p, double & access_time, double & read_energy,
+                         Area & mat_area)
+{
+  access_time = 0;
+  read_energy = 0;
+  mat_area.w  = 0;
+  mat_area.h  = 0;
+
+  if (dyn_p.fully_assoc || dyn_p.pure_cam || dyn_p.is_tag || g_ip->is_3d_mem)
+  {
+    return;
+  }
+
+  Subarray subarray(dyn_p, false);
+  bool   is_dram       = dyn_p.is_dram;
+  int    deg_bl_muxing = dyn_p.deg_bl_muxing;
+  int    ports         = (dyn_p.use_inp_params == 1) ?
+                         dyn_p.num_rw_ports + dyn_p.num_rd_ports + dyn_p.num_search_ports :
+                         g_ip->num_rw_ports + g_ip->num_rd_ports + g_ip->num_search_ports;
+  double cell_w        = dyn_p.cell.w;
+  double R_bl          = subarray.num_rows * dyn_p.cell.h * g_tp.wire_local.R_per_um;
+  double C_bl          = subarray.C_bl;
+
+  double C_drain_bit_mux = drain_C_(g_tp.w_nmos_b_mux, NCH, 1, 0, cell_w / (2 * ports), is_dram);
+  double R_bit_mux = tr_R_on(g_tp.w_nmos_b_mux, NCH, 1, is_dram);
+  double C_drain_sense_amp_iso = drain_C_(g_tp.w_iso, PCH, 1, 0, cell_w * deg_bl_muxing / ports, is_dram);
+  double R_sense_amp_iso = tr_R_on(g_tp.w_iso, PCH, 1, is_dram);
+  double C_sense_amp_latch = gate_C(g_tp.w_sense_p + g_tp.w_sense_n, 0, is_dram) +
+    drain_C_(g_tp.w_sense_n, NCH, 1, 0, cell_w * deg_bl_muxing / ports, is_dram) +
+    drain_C_(g_tp.w_sense_p, PCH, 1, 0, cell_w * deg_bl_muxing / ports, is_dram);
+  double C_drain_sense_amp_mux = drain_C_(g_tp.w_nmos_sa_mux, NCH, 1, 0, cell_w * deg_bl_muxing / ports, is_dram);
+
+  double tstep, V_wl, v_th_mem_cell, bitline_energy;
+  if (is_dram)
+  {
+    double r_dev    = g_tp.dram_cell_Vdd / g_tp.dram_cell_I_on + R_bl / 2;
+    double fraction = dyn_p.V_b_sense / ((g_tp.dram_cell_Vdd/2) * g_tp.dram_cell_C /(g_tp.dram_cell_C + C_bl));
+    double C_ld     = C_bl + 2*C_drain_sense_amp_iso + C_sense_amp_latch + C_drain_sense_amp_mux;
+    tstep = fraction * r_dev * 2.3 * (g_tp.dram_cell_C * C_ld) / (g_tp.dram_cell_C + C_ld);
+    V_wl  = g_tp.vpp;
+    v_th_mem_cell  = g_tp.dram_acc.Vth;
+    bitline_energy = C_ld * (g_tp.dram_cell_Vdd / 2) * g_tp.dram_cell_Vdd;
+  }
+  else
+  {
+    double R_cell_pull_down = tr_R_on(g_tp.sram.cell_nmos_w, NCH, 1, false, true);
+    double R_cell_acc = tr_R_on(g_tp.sram.cell_a_w, NCH, 1, false, true);
+    double tau;
+    if (deg_bl_muxing > 1)
+    {
+      tau = (R_cell_pull_down + R_cell_acc) *
+        (C_bl + 2*C_drain_bit_mux + 2*C_drain_sense_amp_iso + C_sense_amp_latch + C_drain_sense_amp_mux) +
+        R_bl * (C_bl/2 + 2*C_drain_bit_mux + 2*C_drain_sense_amp_iso + C_sense_amp_latch + C_drain_sense_amp_mux) +
+        R_bit_mux * (C_drain_bit_mux + 2*C_drain_sense_amp_iso + C_sense_amp_latch + C_drain_sense_amp_mux) +
+        R_sense_amp_iso * (C_drain_sense_amp_iso + C_sense_amp_latch + C_drain_sense_amp_mux);
+      bitline_energy = (C_bl + 2 * C_drain_bit_mux) * 2 * dyn_p.V_b_sense * g_tp.sram_cell.Vdd +
+        (2 * C_drain_sense_amp_iso + C_sense_amp_latch +  C_drain_sense_amp_mux) *
+        2 * dyn_p.V_b_sense * g_tp.sram_cell.Vdd * (1.0 / deg_bl_muxing);
+    }
+    else
+    {
+      tau = (R_cell_pull_down + R_cell_acc) *
+        (C_bl + C_drain_sense_amp_iso + C_sense_amp_latch + C_drain_sense_amp_mux) + R_bl * C_bl / 2 +
+        R_sense_amp_iso * (C_drain_sense_amp_iso + C_sense_amp_latch + C_drain_sense_amp_mux);
+      bitline_energy = (C_bl + 2 * C_drain_sense_amp_iso + C_sense_amp_latch + C_drain_sense_amp_mux) *
+        2 * dyn_p.V_b_sense * g_tp.sram_cell.Vdd;
+    }
+    tstep = tau * log(g_tp.sram.Vbitpre / (g_tp.sram.Vbitpre - dyn_p.V_b_sense));
+    V_wl  = g_tp.sram_cell.Vdd;
+    v_th_mem_cell = g_tp.sram_cell.Vth;
+  }
+
+  double C_ld_sa = gate_C(g_tp.w_sense_p + g_tp.w_sense_n, 0, is_dram) +
+    drain_C_(g_tp.w_sense_n, NCH, 1, 0, cell_w * deg_bl_muxing / ports, is_dram) +
+    drain_C_(g_tp.w_sense_p, PCH, 1, 0, cell_w * deg_bl_muxing / ports, is_dram) +
+    drain_C_(g_tp.w_iso,PCH,1, 0, cell_w * deg_bl_muxing / ports, is_dram) +
+    drain_C_(g_tp.w_nmos_sa_mux, NCH, 1, 0, cell_w * deg_bl_muxing / ports, is_dram);
+  double delay_sa  = C_ld_sa / g_tp.gm_sense_amp_latch * log(g_tp.peri_global.Vdd / dyn_p.V_b_sense);
+  double energy_sa = C_ld_sa * g_tp.peri_global.Vdd * g_tp.peri_global.Vdd;
+
+  int num_subarrays_per_mat = dyn_p.num_subarrays / dyn_p.num_mats;
+  int num_subarrays_per_row = dyn_p.Ndwl / dyn_p.num_mats_h_dir;
+  int num_sa_subarray       = subarray.num_cols / deg_bl_muxing;
+
+  mat_area.w = num_subarrays_per_row * subarray.area.w;
+  mat_area.h = (num_subarrays_per_mat / num_subarrays_per_row) * subarray.area.h;
+
+  if (V_wl > v_th_mem_cell && tstep > 0 && delay_sa > 0)
+  {
+    access_time = tstep + delay_sa;
+  }
+  if (bitline_energy > 0 && energy_sa > 0)
+  {
+    read_energy = (bitline_energy * subarray.num_cols + energy_sa * num_sa_subarray) *
+                  num_subarrays_per_mat * dyn_p.num_act_mats_hor_dir;
+  }
+}
+
+
+
 double Mat::compute_sa_delay(double inrisetime)
 {
   //int num_sa_subarray = subarray.num_cols / deg_bl_muxing; //in a subarray
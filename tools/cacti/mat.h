@@ -155,6 +155,13 @@ class Mat : public Component
     double compute_sa_delay(double inrisetime);
     double compute_subarray_out_drv(double inrisetime);
 
+    // Lower bounds on the access time and read energy of a RAM data array
+    // organized as dyn_p, taken from its bitlines alone without building the
+    // mat (see compute_bitline_delay), and on the size of its mats, taken
+    // from their subarrays. All are 0 where there is no bound.
+    static void bitline_bounds(const DynamicParameter & dyn_p, double & access_time, double & read_energy,
+                               Area & mat_area);
+
   private:
     double compute_bit_mux_sa_precharge_sa_mux_wr_drv_wr_mux_h();
     double width_write_driver_or_write_mux();
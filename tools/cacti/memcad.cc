@@ -1,108 +1,123 @@
 #include "memcad.h"
+#include "thread_pool.h"
 #include <vector>
 #include <list>
 #include <algorithm>
 #include <iostream>
 #include <cmath>
 #include <cassert>
+#include <map>
 
 using namespace std;
 
 
-vector<channel_conf*> *memcad_all_channels;
+__thread vector<channel_conf*> *memcad_all_channels;
 
-vector<bob_conf*> *memcad_all_bobs;
+__thread vector<bob_conf*> *memcad_all_bobs;
 
-vector<memory_conf*> *memcad_all_memories;
+__thread vector<memory_conf*> *memcad_all_memories;
 
-vector<memory_conf*> *memcad_best_results;
+__thread vector<memory_conf*> *memcad_best_results;
 
-bool compare_channels(channel_conf* first, channel_conf* second)
+// Compare two configurations on the metric order of memcad_params:
+// negative if first is better, positive if second is, zero on a tie.
+template<class T>
+int compare_metrics(const T* first, const T* second)
 {
-	if(first->capacity != second->capacity)
-		return (first->capacity < second->capacity);
-	
-	MemCad_metrics first_metric = first->memcad_params->first_metric;
-	MemCad_metrics second_metric = first->memcad_params->second_metric;
-	MemCad_metrics third_metric = first->memcad_params->third_metric;	
-	
-	switch(first_metric)
-	{
-		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
-		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
-		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
-		default:
-			assert(false);
-	}
+	MemCad_metrics metrics[3];
+	metrics[0] = first->memcad_params->first_metric;
+	metrics[1] = first->memcad_params->second_metric;
+	metrics[2] = first->memcad_params->third_metric;
 	
-	switch(second_metric)
+	for(int i=0;i<3;i++)
 	{
-		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
-		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
-		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
-		default:
-			assert(false);
+		switch(metrics[i])
+		{
+			case(Cost):
+				if(first->cost != second->cost)
+					return (first->cost < second->cost)?-1:1;
+				break;
+			case(Bandwidth):
+				if(first->bandwidth != second->bandwidth)
+					return (first->bandwidth > second->bandwidth)?-1:1;
+				break;
+			case(Energy):
+				if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
+					return (first->energy_per_access <  second->energy_per_access)?-1:1;
+				break;
+			default:
+				assert(false);
+		}
 	}
-	
-	switch(third_metric)
+	return 0;
+}
+
+// Keep conf if it beats the best configuration of the same capacity seen so
+// far; ties keep the earlier one. Returns the configuration that lost (NULL
+// if none) so the caller can delete it or reuse its storage.
+template<class T>
+T* keep_best(map<int, T*> & best, T* conf)
+{
+	T* & slot = best[conf->capacity];
+	if(slot == NULL)
 	{
-		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
-		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
-		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
-		default:
-			assert(false);
+		slot = conf;
+		return NULL;
 	}
-	return true;
+	if(compare_metrics(conf, slot) < 0)
+		swap(slot, conf);
+	return conf;
 }
 
+// A channel configuration enumerated by find_all_channels().
+struct channel_spec
+{
+	vector<int> dimm_cap;
+	int bandwidth;
+	Mem_DIMM type;
+	bool low_power;
+	channel_conf * conf;
+	
+	channel_spec(const vector<int>& dimm_cap, int bandwidth, Mem_DIMM type, bool low_power)
+	:dimm_cap(dimm_cap),bandwidth(bandwidth),type(type),low_power(low_power),conf(NULL) {}
+};
+
+struct build_channels_struct
+{
+	MemCadParameters * memcad_params;
+	vector<channel_spec> * specs;
+};
+
+void build_channel_mt(void * void_obj, uint64_t idx, uint32_t slot)
+{
+	build_channels_struct * obj = (build_channels_struct *) void_obj;
+	channel_spec & spec = (*obj->specs)[idx];
+	spec.conf = new channel_conf(obj->memcad_params, spec.dimm_cap, spec.bandwidth, spec.type, spec.low_power);
+}
 
-void prune_channels()
+// Evaluate the enumerated channels on the thread pool and keep the best
+// feasible one of each capacity, in capacity order.
+void build_channels(MemCadParameters * memcad_params, vector<channel_spec> & specs)
 {
-	vector<channel_conf*> * temp = new vector<channel_conf*>();
-	int last_added = -1;
-	for(unsigned int i=0;i< memcad_all_channels->size();i++)
+	build_channels_struct obj;
+	obj.memcad_params = memcad_params;
+	obj.specs = &specs;
+	ThreadPool::instance().parallel_for(specs.size(), build_channel_mt, (void *) &obj);
+	
+	map<int, channel_conf*> best;
+	for(unsigned int i=0;i<specs.size();i++)
 	{
-		if(last_added != (*memcad_all_channels)[i]->capacity)
+		if(specs[i].conf->cost <INF)
 		{
-			temp->push_back(clone((*memcad_all_channels)[i]));
-			last_added = (*memcad_all_channels)[i]->capacity;
+			delete keep_best(best, specs[i].conf);
+		}
+		else
+		{
+			delete specs[i].conf;
 		}
 	}
-	 
-	for(unsigned int i=0;i< memcad_all_channels->size();i++)
-	{
-		delete (*memcad_all_channels)[i];	
-	}
-	memcad_all_channels->clear();
-	delete memcad_all_channels;
-	memcad_all_channels  = temp;
+	for(map<int, channel_conf*>::iterator it=best.begin(); it!=best.end(); ++it)
+		memcad_all_channels->push_back(it->second);
 }
 
 void find_all_channels(MemCadParameters * memcad_params)
@@ -114,6 +129,7 @@ void find_all_channels(MemCadParameters * memcad_params)
 	
 	
 	memcad_all_channels= new vector<channel_conf*>();
+	vector<channel_spec> channel_specs;
 	
 	// channels can have up to 3 DIMMs per channel
 	// di is the capacity if i-th dimm in the channel
@@ -142,22 +158,14 @@ void find_all_channels(MemCadParameters * memcad_params)
 					for(int bw_id=0;bw_id<=max_index; ++bw_id)
 					{
 						int bandwidth = MemoryParameters::bandwidth_load[current_io_type][bw_id];
-						channel_conf * new_channel = new channel_conf(memcad_params, dimm_cap, bandwidth, LRDIMM, false);
-						if(new_channel->cost <INF)
-						{
-							memcad_all_channels->push_back(new_channel);
-						}
+						channel_specs.push_back(channel_spec(dimm_cap, bandwidth, LRDIMM, false));
 						
 						if((DIMM_size[d1]+DIMM_size[d2]+DIMM_size[d3])==0)
 							continue;
 						
 						if(memcad_params->low_power_permitted)
 						{
-							new_channel = new channel_conf(memcad_params, dimm_cap, bandwidth, LRDIMM, true);
-							if(new_channel->cost <INF)
-							{
-								memcad_all_channels->push_back(new_channel);
-							}
+							channel_specs.push_back(channel_spec(dimm_cap, bandwidth, LRDIMM, true));
 						}
 						
 					}
@@ -183,19 +191,11 @@ void find_all_channels(MemCadParameters * memcad_params)
 					for(int bw_id=0;bw_id<=max_index; ++bw_id)
 					{
 						int bandwidth = MemoryParameters::bandwidth_load[current_io_type][bw_id];
-						channel_conf * new_channel = new channel_conf(memcad_params, dimm_cap, bandwidth, RDIMM, false);
-						if(new_channel->cost <INF)
-						{
-							memcad_all_channels->push_back(new_channel);
-						}
+						channel_specs.push_back(channel_spec(dimm_cap, bandwidth, RDIMM, false));
 						
 						if(memcad_params->low_power_permitted)
 						{
-							new_channel = new channel_conf(memcad_params, dimm_cap, bandwidth, RDIMM, true);
-							if(new_channel->cost <INF)
-							{
-								memcad_all_channels->push_back(new_channel);
-							}
+							channel_specs.push_back(channel_spec(dimm_cap, bandwidth, RDIMM, true));
 						}
 					}
 				}
@@ -217,19 +217,11 @@ void find_all_channels(MemCadParameters * memcad_params)
 					for(int bw_id=0;bw_id<=max_index; ++bw_id)
 					{
 						int bandwidth = MemoryParameters::bandwidth_load[current_io_type][bw_id];	
-						channel_conf * new_channel = new channel_conf(memcad_params, dimm_cap, bandwidth, UDIMM, false);
-						if(new_channel->cost <INF)
-						{
-							memcad_all_channels->push_back(new_channel);
-						}
+						channel_specs.push_back(channel_spec(dimm_cap, bandwidth, UDIMM, false));
 						
 						if(memcad_params->low_power_permitted)
 						{
-							new_channel = new channel_conf(memcad_params, dimm_cap, bandwidth, UDIMM, true);
-							if(new_channel->cost <INF)
-							{
-								memcad_all_channels->push_back(new_channel);
-							}
+							channel_specs.push_back(channel_spec(dimm_cap, bandwidth, UDIMM, true));
 						}
 					}
 				}
@@ -238,10 +230,7 @@ void find_all_channels(MemCadParameters * memcad_params)
 		}
 	}
 	
-	sort(memcad_all_channels->begin(), memcad_all_channels->end(), compare_channels); 
-	
-	
-	prune_channels();
+	build_channels(memcad_params, channel_specs);
 	
 	if(memcad_params->verbose)
 	{
@@ -258,125 +247,55 @@ bool compare_channels_bw(channel_conf* first, channel_conf* second)
 	return (first->bandwidth < second->bandwidth);
 }
 
-bool compare_bobs(bob_conf* first, bob_conf* second)
+// One subtree of the BoB enumeration: the BoBs whose first channel is
+// channels[first], drawn from the same-bandwidth run ending at last.
+struct bob_search
 {
-	if(first->capacity != second->capacity)
-		return (first->capacity < second->capacity);
-	
-	MemCad_metrics first_metric = first->memcad_params->first_metric;
-	MemCad_metrics second_metric = first->memcad_params->second_metric;
-	MemCad_metrics third_metric = first->memcad_params->third_metric;	
-	
-	switch(first_metric)
-	{
-		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
-		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
-		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
-		default:
-			assert(false);
-	}
+	MemCadParameters * memcad_params;
+	vector<channel_conf*> * channels;
+	int first;
+	int last;
+	vector<channel_conf*> picked;
+	map<int, bob_conf*> best;
+	bob_conf * spare; // storage of the last rejected candidate
 	
-	switch(second_metric)
-	{
-		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
-		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
-		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
-		default:
-			assert(false);
-	}
-	
-	switch(third_metric)
-	{
-		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
-		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
-		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
-		default:
-			assert(false);
-	}
-	return true;
-}
+	bob_search(MemCadParameters * memcad_params, vector<channel_conf*> * channels, int first, int last)
+	:memcad_params(memcad_params),channels(channels),first(first),last(last),spare(NULL) {}
+};
 
-void prune_bobs()
+void find_bobs_recursive(bob_search * s, int start, int nb)
 {
-	vector<bob_conf*> * temp = new vector<bob_conf*>();
-	int last_added = -1;
-	for(unsigned int i=0;i< memcad_all_bobs->size();i++)
+	if(nb==0)
 	{
-		if(last_added != (*memcad_all_bobs)[i]->capacity)
-		{
-			temp->push_back(clone((*memcad_all_bobs)[i]));
-			last_added = (*memcad_all_bobs)[i]->capacity;
-		}
+		bob_conf * conf = s->spare;
+		if(conf)
+			*conf = bob_conf(s->memcad_params, &s->picked);
+		else
+			conf = new bob_conf(s->memcad_params, &s->picked);
+		s->spare = keep_best(s->best, conf);
+		return;
 	}
-	 
-	for(unsigned int i=0;i< memcad_all_bobs->size();i++)
+	for(int i=start;i<=s->last;++i)
 	{
-		delete (*memcad_all_bobs)[i];	
+		s->picked.push_back((*s->channels)[i]);
+		find_bobs_recursive(s, i, nb-1);
+		s->picked.pop_back();
 	}
-	memcad_all_bobs->clear();
-	delete memcad_all_bobs;
-	memcad_all_bobs  = temp;
 }
 
-void find_bobs_recursive(MemCadParameters * memcad_params,int start,int end,int nb, list<int> *channel_index)
+void find_bobs_mt(void * void_obj, uint64_t idx, uint32_t slot)
 {
-	if(nb==1)
-	{
-		for(int i=start; i<=end;++i)
-		{
-			channel_index->push_back(i);
-			
-			vector<channel_conf*> temp;
-			for(list<int>::iterator it= channel_index->begin(); it!= channel_index->end(); it++)
-			{
-				int idx = *it;
-				temp.push_back((*memcad_all_channels)[idx]);
-			}
-			memcad_all_bobs->push_back(new bob_conf(memcad_params, &temp));
-			temp.clear();
-			
-			channel_index->pop_back();
-		}
-		return;
-	}
-	for(int i=start;i<=end;++i)
-	{
-		channel_index->push_back(i);
-		find_bobs_recursive(memcad_params,i,end,nb-1,channel_index);	
-		channel_index->pop_back();
-	}
+	bob_search * s = (*(vector<bob_search*> *) void_obj)[idx];
+	s->picked.push_back((*s->channels)[s->first]);
+	find_bobs_recursive(s, s->first, s->memcad_params->num_channels_per_bob-1);
+	s->picked.pop_back();
+	delete s->spare;
 }
 
 void find_all_bobs(MemCadParameters * memcad_params)
 {
 	memcad_all_bobs = new vector<bob_conf*>();
+	map<int, bob_conf*> best;
 	if(memcad_params->mirror_in_bob)
 	{
 		for(unsigned int i=0;i<memcad_all_channels->size();++i)
@@ -384,7 +303,7 @@ void find_all_bobs(MemCadParameters * memcad_params)
 			vector<channel_conf*> channels;
 			for(int j=0;j<memcad_params->num_channels_per_bob;j++)
 				channels.push_back((*memcad_all_channels)[i]);
-			memcad_all_bobs->push_back(new bob_conf(memcad_params, &channels));
+			delete keep_best(best, new bob_conf(memcad_params, &channels));
 			channels.clear();	
 		}
 	}
@@ -405,13 +324,23 @@ void find_all_bobs(MemCadParameters * memcad_params)
 		}
 		end_index.push_back(memcad_all_channels->size()-1);
 		
-		list<int> channel_index;
-		
+		// every first channel of a same-bandwidth run is its own subtree;
+		// merging them in enumeration order keeps the serial tie-breaking
+		vector<bob_search*> subtrees;
 		for(unsigned int i=0;i< start_index.size();++i)
 		{
-			find_bobs_recursive(memcad_params,start_index[i],end_index[i],memcad_params->num_channels_per_bob, &channel_index);	
+			for(int j=start_index[i];j<=end_index[i];++j)
+				subtrees.push_back(new bob_search(memcad_params, memcad_all_channels, j, end_index[i]));
 		}
+		ThreadPool::instance().parallel_for(subtrees.size(), find_bobs_mt, (void *) &subtrees);
 		
+		for(unsigned int i=0;i< subtrees.size();++i)
+		{
+			map<int, bob_conf*> & sub_best = subtrees[i]->best;
+			for(map<int, bob_conf*>::iterator it=sub_best.begin(); it!=sub_best.end(); ++it)
+				delete keep_best(best, it->second);
+			delete subtrees[i];
+		}
 	}
 	else
 	{
@@ -419,9 +348,9 @@ void find_all_bobs(MemCadParameters * memcad_params)
 		assert(false);
 	}
 	
+	for(map<int, bob_conf*>::iterator it=best.begin(); it!=best.end(); ++it)
+		memcad_all_bobs->push_back(it->second);
 	
-	sort(memcad_all_bobs->begin(), memcad_all_bobs->end(), compare_bobs); 
-	prune_bobs();
 	if(memcad_params->verbose)
 	{
 		for(unsigned int i=0;i<memcad_all_bobs->size();i++)
@@ -431,117 +360,165 @@ void find_all_bobs(MemCadParameters * memcad_params)
 	}
 }
 
-void find_mems_recursive(MemCadParameters * memcad_params, int remaining_capacity, int start,  int nb, list<int>* bobs_index)
+// One subtree of the memory enumeration: the memories whose first BoB is
+// bobs[first]. Unless every result is to be listed, only the best
+// MEMCAD_NUM_RESULTS are kept and subtrees that cannot improve on the
+// worst of them on the first metric are cut.
+struct mem_search
 {
+	MemCadParameters * memcad_params;
+	vector<bob_conf*> * bobs;
+	const vector<double> * bound; // best first metric of a single BoB in bobs[i..]
+	int first;
+	bool keep_all;
+	vector<bob_conf*> picked;
+	double picked_metric;
+	vector<memory_conf> results;
 	
-	if(nb==1)
-	{
-		for(unsigned int i=start; i< memcad_all_bobs->size();++i)
-		{
-			if((*memcad_all_bobs)[i]->capacity != remaining_capacity)
-				continue;
-			
-			bobs_index->push_back(i);
-			vector<bob_conf*> temp;
-			for(list<int>::iterator it= bobs_index->begin(); it!= bobs_index->end(); it++)
-			{
-				int index = *it;
-				temp.push_back((*memcad_all_bobs)[index]);
-			}
-			memcad_all_memories->push_back(new memory_conf(memcad_params, &temp));
-			temp.clear();
-			bobs_index->pop_back();
-		}
-		return;
-	}
-	
-	for(unsigned int i=start; i<memcad_all_bobs->size();i++)
-	{
-		if((*memcad_all_bobs)[i]->capacity > remaining_capacity)
-			continue;
-		
-		int new_remaining_capacity = remaining_capacity-(*memcad_all_bobs)[i]->capacity;
-		bobs_index->push_back(i);
-		find_mems_recursive(memcad_params, new_remaining_capacity, i, nb-1, bobs_index);
-		bobs_index->pop_back();
-	}
-}
-
-//void find_mems_recursive(MemCadParameters * memcad_params, int start, int 
+	mem_search(MemCadParameters * memcad_params, vector<bob_conf*> * bobs, const vector<double> * bound, int first, bool keep_all)
+	:memcad_params(memcad_params),bobs(bobs),bound(bound),first(first),keep_all(keep_all),picked_metric(0) {}
+};
 
-bool compare_memories(memory_conf* first, memory_conf* second)
+double first_metric_of(const bob_conf * bob)
 {
-	if(first->capacity != second->capacity)
-		return (first->capacity < second->capacity);
-	
-	MemCad_metrics first_metric = first->memcad_params->first_metric;
-	MemCad_metrics second_metric = first->memcad_params->second_metric;
-	MemCad_metrics third_metric = first->memcad_params->third_metric;	
-	
-	switch(first_metric)
+	switch(bob->memcad_params->first_metric)
 	{
 		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
+			return bob->cost;
 		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
+			return -bob->bandwidth;
 		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
+			return bob->energy_per_access;
 		default:
 			assert(false);
 	}
-	
-	switch(second_metric)
+	return 0;
+}
+
+double first_metric_of(const memory_conf * mem)
+{
+	switch(mem->memcad_params->first_metric)
 	{
 		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
+			return mem->cost;
 		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
+			return -mem->bandwidth;
 		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
+			return mem->energy_per_access;
 		default:
 			assert(false);
 	}
+	return 0;
+}
+
+// Insert conf into the ordered list of the best results; ties go after the
+// results already there.
+void keep_top(vector<memory_conf> & top, const memory_conf & conf)
+{
+	unsigned int pos = top.size();
+	while(pos>0 && compare_metrics(&conf, &top[pos-1]) < 0)
+		pos--;
+	if(pos >= MEMCAD_NUM_RESULTS)
+		return;
+	top.insert(top.begin()+pos, conf);
+	if(top.size() > MEMCAD_NUM_RESULTS)
+		top.pop_back();
+}
+
+void find_mems_recursive(mem_search * s, int remaining_capacity, int start, int nb)
+{
+	if(nb==0)
+	{
+		if(remaining_capacity != 0)
+			return;
+		memory_conf conf(s->memcad_params, &s->picked);
+		if(s->keep_all)
+			s->results.push_back(conf);
+		else
+			keep_top(s->results, conf);
+		return;
+	}
+	
+	// every remaining BoB is at best as good as the best one left, so the
+	// subtree cannot reach the list if even that is clearly worse
+	if(!s->keep_all && s->results.size() == MEMCAD_NUM_RESULTS &&
+	   s->picked_metric + nb*(*s->bound)[start] - first_metric_of(&s->results.back()) > 2*EPS)
+		return;
 	
-	switch(third_metric)
+	for(unsigned int i=start; i<s->bobs->size();i++)
 	{
-		case(Cost):
-			if(first->cost != second->cost)
-				return (first->cost < second->cost);
-			break;
-		case(Bandwidth):
-			if(first->bandwidth != second->bandwidth)
-				return (first->bandwidth > second->bandwidth);
-			break;
-		case(Energy):
-			if( fabs(first->energy_per_access -  second->energy_per_access)>EPS)
-				return (first->energy_per_access <  second->energy_per_access);
-			break;
-		default:
-			assert(false);
+		bob_conf * bob = (*s->bobs)[i];
+		if(bob->capacity > remaining_capacity)
+			continue;
+		
+		s->picked.push_back(bob);
+		s->picked_metric += first_metric_of(bob);
+		find_mems_recursive(s, remaining_capacity-bob->capacity, i, nb-1);
+		s->picked_metric -= first_metric_of(bob);
+		s->picked.pop_back();
 	}
-	return true;
+}
+
+void find_mems_mt(void * void_obj, uint64_t idx, uint32_t slot)
+{
+	mem_search * s = (*(vector<mem_search*> *) void_obj)[idx];
+	bob_conf * bob = (*s->bobs)[s->first];
+	if(bob->capacity > s->memcad_params->capacity)
+		return;
+	
+	s->picked.push_back(bob);
+	s->picked_metric = first_metric_of(bob);
+	find_mems_recursive(s, s->memcad_params->capacity-bob->capacity, s->first, s->memcad_params->num_bobs-1);
+}
+
+bool compare_memories(memory_conf* first, memory_conf* second)
+{
+	if(first->capacity != second->capacity)
+		return (first->capacity < second->capacity);
+	return (compare_metrics(first, second) <= 0);
 }
 
 bool find_all_memories(MemCadParameters * memcad_params)
 {
 	memcad_all_memories = new vector<memory_conf*>();
 	
-	list<int> bobs_index;
-	find_mems_recursive(memcad_params, memcad_params->capacity, 0,memcad_params->num_bobs, &bobs_index);	
+	// the full list is only needed when every result is printed
+	bool keep_all = memcad_params->verbose;
+	
+	vector<double> bound(memcad_all_bobs->size());
+	for(int i=(int)memcad_all_bobs->size()-1;i>=0;--i)
+	{
+		bound[i] = first_metric_of((*memcad_all_bobs)[i]);
+		if(i+1 < (int)bound.size())
+			bound[i] = min(bound[i], bound[i+1]);
+	}
 	
-	sort(memcad_all_memories->begin(), memcad_all_memories->end(), compare_memories);
+	vector<mem_search*> subtrees;
+	for(unsigned int i=0;i< memcad_all_bobs->size();++i)
+		subtrees.push_back(new mem_search(memcad_params, memcad_all_bobs, &bound, i, keep_all));
+	ThreadPool::instance().parallel_for(subtrees.size(), find_mems_mt, (void *) &subtrees);
+	
+	vector<memory_conf> top;
+	for(unsigned int i=0;i< subtrees.size();++i)
+	{
+		vector<memory_conf> & results = subtrees[i]->results;
+		for(unsigned int j=0;j< results.size();++j)
+		{
+			if(keep_all)
+				memcad_all_memories->push_back(new memory_conf(results[j]));
+			else
+				keep_top(top, results[j]);
+		}
+		delete subtrees[i];
+	}
+	
+	if(keep_all)
+		sort(memcad_all_memories->begin(), memcad_all_memories->end(), compare_memories);
+	else
+	{
+		for(unsigned int i=0;i< top.size();++i)
+			memcad_all_memories->push_back(new memory_conf(top[i]));
+	}
 	
 	if(memcad_params->verbose)
 	{
@@ -556,8 +533,8 @@ bool find_all_memories(MemCadParameters * memcad_params)
 		cout << "No result found " << endl;
 		return false;
 	}
-	cout << "top 3 best memory configurations are:" << endl;
-	int min_num_results = (memcad_all_memories->size()>3?3:memcad_all_memories->size());
+	cout << "top " << MEMCAD_NUM_RESULTS << " best memory configurations are:" << endl;
+	int min_num_results = (memcad_all_memories->size()>MEMCAD_NUM_RESULTS?MEMCAD_NUM_RESULTS:memcad_all_memories->size());
 	for(int i=0;i<min_num_results;++i)
 	{
 		if((*memcad_all_memories)[i])
@@ -4,14 +4,17 @@
 #include "memcad_parameters.h"
 #include <vector>
 
+// number of best memory configurations reported
+#define MEMCAD_NUM_RESULTS 3
 
-extern vector<channel_conf*> *memcad_all_channels;
+// MemCAD search state of the solve running on this thread
+extern __thread vector<channel_conf*> *memcad_all_channels;
 
-extern vector<bob_conf*> *memcad_all_bobs;
+extern __thread vector<bob_conf*> *memcad_all_bobs;
 
-extern vector<memory_conf*> *memcad_all_memories;
+extern __thread vector<memory_conf*> *memcad_all_memories;
 
-extern vector<memory_conf*> *memcad_best_results;
+extern __thread vector<memory_conf*> *memcad_best_results;
 
 
 
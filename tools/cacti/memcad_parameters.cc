@@ -2,7 +2,7 @@
 #include <cmath>
 #include <cassert>
 
-MemCadParameters::MemCadParameters(InputParameter * g_ip)
+MemCadParameters::MemCadParameters(InputParameter * ip)
 {
 	// default value
 	io_type=DDR4; // DDR3 vs. DDR4
@@ -23,22 +23,22 @@ MemCadParameters::MemCadParameters(InputParameter * g_ip)
 	total_power=false; // false means just considering I/O Power. 
 	verbose=false;
 	// values for input
-	io_type=g_ip->io_type; 
-	capacity=g_ip->capacity; 
-	num_bobs=g_ip->num_bobs; 
-	num_channels_per_bob=g_ip->num_channels_per_bob; 
-	first_metric=g_ip->first_metric;
-	second_metric=g_ip->second_metric;
-	third_metric=g_ip->third_metric;
-	dimm_model=g_ip->dimm_model; 
-	///low_power_permitted=g_ip->low_power_permitted;
-	///load=g_ip->load; 
-	///row_buffer_hit_rate=g_ip->row_buffer_hit_rate; 
-	///rd_2_wr_ratio=g_ip->rd_2_wr_ratio;
-	///same_bw_in_bob=g_ip->same_bw_in_bob; 
-	mirror_in_bob=g_ip->mirror_in_bob;
-	///total_power=g_ip->total_power; 
-	verbose=g_ip->verbose;
+	io_type=ip->io_type; 
+	capacity=ip->capacity; 
+	num_bobs=ip->num_bobs; 
+	num_channels_per_bob=ip->num_channels_per_bob; 
+	first_metric=ip->first_metric;
+	second_metric=ip->second_metric;
+	third_metric=ip->third_metric;
+	dimm_model=ip->dimm_model; 
+	///low_power_permitted=ip->low_power_permitted;
+	///load=ip->load; 
+	///row_buffer_hit_rate=ip->row_buffer_hit_rate; 
+	///rd_2_wr_ratio=ip->rd_2_wr_ratio;
+	///same_bw_in_bob=ip->same_bw_in_bob; 
+	mirror_in_bob=ip->mirror_in_bob;
+	///total_power=ip->total_power; 
+	verbose=ip->verbose;
 	
 }
 	
@@ -89,7 +89,7 @@ class MemCadParameters
 	bool verbose;
 	
 	// Functions
-	MemCadParameters(InputParameter * g_ip);
+	MemCadParameters(InputParameter * ip);
 	void print_inputs();
 	bool sanity_check();
 
@@ -55,6 +55,9 @@ Memorybus::Memorybus(
     power.readOp.gate_leakage = 0;
     power.searchOp.dynamic =0;
 	delay = 0;
+	// each bus type only sizes its own parts, but the area below adds up all of them
+	area_lwl_drv = area_row_predec_dec = area_col_predec_dec = 0;
+	area_data_drv = area_IOSA = area_local_dataline = 0;
 
 	cell.h = g_tp.dram.b_h;
 	cell.w = g_tp.dram.b_w;
@@ -34,14 +34,14 @@
 #include "nuca.h"
 #include "Ucache.h"
 #include <assert.h>
+#include <pthread.h>
+#include <vector>
 
-unsigned int MIN_BANKSIZE=65536;
+#define MIN_BANKSIZE 65536
 #define FIXED_OVERHEAD 55e-12 /* clock skew and jitter in s. Ref: Hrishikesh et al ISCA 01 */
 #define LATCH_DELAY 28e-12 /* latch delay in s (later should use FO4 TODO) */
 #define CONTR_2_BANK_LAT 0
 
-int cont_stats[2 /*l2 or l3*/][5/* cores */][ROUTER_TYPES][7 /*banks*/][8 /* cycle time */];
-
   Nuca::Nuca(
       /*TechnologyParameter::*/DeviceType *dt = &(g_tp.peri_global)
       ):deviceType(dt)
@@ -120,6 +120,28 @@ nuca_org_t::~nuca_org_t() {
   // if(router) delete router;
 }
 
+// One bank size of the NUCA exploration, solved in its own context.
+struct nuca_bank_solve
+{
+  InputParameter ip;
+  SolverContext  ctx;
+  uca_org_t      ures;
+  pthread_t      thread;
+
+  nuca_bank_solve(const InputParameter & ip_) : ip(ip_), ctx(&ip) { }
+};
+
+static void * solve_nuca_bank(void * arg)
+{
+  nuca_bank_solve * b = (nuca_bank_solve *) arg;
+
+  b->ctx.bind();
+  solve(&b->ures);
+  return NULL;
+}
+
+
+
 /*
  * Version - 6.0
  *
@@ -148,7 +170,6 @@ Nuca::sim_nuca()
   int bank_count = 0;
   uca_org_t ures;
   nuca_org_t *opt_n;
-  mem_array tag, data;
   list<nuca_org_t *> nuca_list;
   Router *router_s[ROUTER_TYPES];
   router_s[0] = new Router(64.0, 8, 4, &(g_tp.peri_global));
@@ -199,15 +220,16 @@ Nuca::sim_nuca()
 
 
   // set the lower bound to an appropriate value. this depends on cache associativity
+  unsigned int min_banksize = MIN_BANKSIZE;
   if (g_ip->assoc > 2) {
     i = 2;
     while (i != g_ip->assoc) {
-      MIN_BANKSIZE *= 2;
+      min_banksize *= 2;
       i *= 2;
     }
   }
 
-  iterations = (int)logtwo((int)g_ip->cache_sz/MIN_BANKSIZE);
+  iterations = (int)logtwo((int)g_ip->cache_sz/min_banksize);
 
   if (g_ip->force_wiretype)
   {
@@ -235,33 +257,54 @@ Nuca::sim_nuca()
     g_ip->cache_sz = g_ip->cache_sz/g_ip->nuca_bank_count;
   }
   cout << "Simulating various NUCA configurations\n";
+
+  /*
+   * find the optimal bank organization of every bank size up front; the
+   * bank sizes are solved concurrently, each in its own context and
+   * thread, and their partition sweeps share the thread pool
+   */
+  vector<nuca_bank_solve *> bank(iterations - bank_start);
+  unsigned int bank_sz = g_ip->cache_sz;
+  for (it=bank_start; it<iterations; it++) {
+    nuca_bank_solve * b = new nuca_bank_solve(*g_ip);
+    b->ip.cache_sz = bank_sz;
+    // banks are solved with the wire models as the routers' crossbars
+    // left them, as when they were solved one after the other
+    *b->ctx.wire = *g_ctx->wire;
+    bank_sz /= 2;
+    if (pthread_create(&b->thread, NULL, solve_nuca_bank, (void *) b) != 0)
+    {
+      cerr << "Unable to create NUCA bank thread\n";
+      exit(1);
+    }
+    bank[it - bank_start] = b;
+  }
+  for (it=bank_start; it<iterations; it++) {
+    pthread_join(bank[it - bank_start]->thread, NULL);
+  }
+
   for (it=bank_start; it<iterations; it++) { /* different bank count values */
-    ures.tag_array2 = &tag;
-    ures.data_array2 = &data;
-    /*
-     * find the optimal bank organization
-     */
-    solve(&ures);
+    ures = bank[it - bank_start]->ures;
 //    output_UCA(&ures);
     bank_count = g_ip->nuca_cache_sz/g_ip->cache_sz;
     cout << "====" <<  g_ip->cache_sz << "\n";
 
     for (wr=wt_min; wr<=wt_max; wr++) {
 
+      /* calculate wire parameters, shared by all router types */
+
+      double vlength = ures.cache_ht; /* length of the wire (u)*/
+      double hlength = ures.cache_len; // u
+
+      /* find delay, area, and power for wires */
+      wire_vertical[wr] = new Wire((enum Wire_type) wr, vlength);
+      wire_horizontal[wr] = new Wire((enum Wire_type) wr, hlength);
+
       for (ro=0; ro<ROUTER_TYPES; ro++)
       {
         flit_width = (int) router_s[ro]->flit_size; //initialize router
         nuca_list.back()->nuca_pda.cycle_time = router_s[ro]->cycle_time;
 
-        /* calculate router and wire parameters */
-
-        double vlength = ures.cache_ht; /* length of the wire (u)*/
-        double hlength = ures.cache_len; // u
-
-        /* find delay, area, and power for wires */
-        wire_vertical[wr] = new Wire((enum Wire_type) wr, vlength);
-        wire_horizontal[wr] = new Wire((enum Wire_type) wr, hlength);
-
 
         hor_hop_lat = calc_cycles(wire_horizontal[wr]->delay,
             1/(nuca_list.back()->nuca_pda.cycle_time*.001));
@@ -386,6 +429,9 @@ Nuca::sim_nuca()
         nuca_list.back()->bank_count = bank_count;
         nuca_list.back()->rows = opt_rows;
         nuca_list.back()->columns = opt_columns;
+        nuca_list.back()->router_type = ro;
+        nuca_list.back()->bank_data = array_org(ures.data_array2);
+        nuca_list.back()->bank_tag = array_org(ures.tag_array2);
         calculate_nuca_area (nuca_list.back());
 
         minval.update_min_values(nuca_list.back());
@@ -397,6 +443,11 @@ Nuca::sim_nuca()
     g_ip->cache_sz /= 2;
   }
 
+  for (it=bank_start; it<iterations; it++) {
+    bank[it - bank_start]->ures.cleanup();
+    delete bank[it - bank_start];
+  }
+
   delete(nuca_list.back());
   nuca_list.pop_back();
   opt_n = find_optimal_nuca(&nuca_list, &minval);
@@ -503,6 +554,9 @@ Nuca::find_optimal_nuca (list<nuca_org_t *> *n, min_values_t *minval)
 
   list<nuca_org_t *>::iterator niter;
 
+  if (ParetoFront::enabled()) {
+    ParetoFront::write(*n);
+  }
 
   for (niter = n->begin(); niter != n->end(); niter++) {
     fprintf(stderr, "\n-----------------------------"
@@ -42,6 +42,7 @@
 #include "mat.h"
 #include "io.h"
 #include "router.h"
+#include "pareto.h"
 #include <iostream>
 
 
@@ -68,6 +69,11 @@ class nuca_org_t {
     int rows;
     int columns;
     int bank_count;
+    int router_type;
+
+    /* partitions of a bank */
+    array_org bank_data;
+    array_org bank_tag;
 };
 
 
@@ -94,6 +100,7 @@ class Nuca : public Component
     int wt_min, wt_max;
     Wire *wire_vertical[WIRE_TYPES],
          *wire_horizontal[WIRE_TYPES];
+    int cont_stats[2 /*l2 or l3*/][5/* cores */][ROUTER_TYPES][7 /*banks*/][8 /* cycle time */];
 
 };
 
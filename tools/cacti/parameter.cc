@@ -34,18 +34,42 @@
 #include <iostream>
 #include <string>
 #include <iomanip>
+#include <cstdlib>
+#include <cctype>
+#include <cstring>
+#include <pthread.h>
 
 #include "parameter.h"
 #include "area.h"
 
 #include "basic_circuit.h"
+#include "wire.h"
+#include "Ucache.h"
 #include <cassert>
 
 using namespace std;
 
 
-InputParameter * g_ip;
-TechnologyParameter g_tp;
+static SolverContext default_solver_context;
+__thread SolverContext * g_ctx = &default_solver_context;
+
+SolverContext::SolverContext(InputParameter * ip_)
+  :ip(ip_), wire(new WireTables()), last_solve(NULL)
+{
+}
+
+SolverContext::~SolverContext()
+{
+	delete wire;
+	delete last_solve;
+}
+
+SolverContext * SolverContext::bind()
+{
+	SolverContext * prev = g_ctx;
+	g_ctx = this;
+	return prev;
+}
 
 // ali
 bool is_equal(double first, double second)
@@ -136,177 +160,198 @@ bool DeviceType::isEqual(const DeviceType & dev)
 	return true;
 }
 
-double scan_single_input_double(char* line, const char* name, const char* unit_name, bool print)
+static pthread_mutex_t tech_data_lock = PTHREAD_MUTEX_INITIALIZER;
+static map<string, TechDataFile *> tech_data_files;
+
+const TechDataFile & TechDataFile::get(const string & in_file)
 {
-	double temp;
-	char unit[300];
-	memset(unit,0,300);
-	sscanf(&line[strlen(name)], "%*[ \t]%s%*[ \t]%lf",unit,&temp);
-	if(print)
-		cout << name << ": " << temp << " " << unit << endl;
-	return temp;
+	pthread_mutex_lock(&tech_data_lock);
+	TechDataFile * & tech = tech_data_files[in_file];
+	if (tech == NULL)
+	{
+		FILE *fp = fopen(in_file.c_str(), "r");
+		if(!fp) {
+		cout << in_file << " is missing!\n";
+		exit(-1);
+		}
+		tech = new TechDataFile();
+		tech->parse(fp);
+		fclose(fp);
+	}
+	pthread_mutex_unlock(&tech_data_lock);
+	return *tech;
 }
 
-double scan_five_input_double(char* line, const char* name, const char* unit_name, int flavor, bool print)
+// Interpolated parameter sets, keyed by everything init() reads from g_ip.
+static pthread_mutex_t tech_param_lock = PTHREAD_MUTEX_INITIALIZER;
+static map<vector<double>, TechnologyParameter> tech_params;
+
+void TechnologyParameter::load(double technology, bool is_tag)
 {
-  double temp[5];	
-  char unit[300];
-  memset(unit,0,300);
-  sscanf(&line[strlen(name)], "%*[ \t]%s%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf"
-		,unit,&(temp[0]),&(temp[1]),&(temp[2]),&(temp[3]), &(temp[4]) );
-		
-  if (print)
-		cout << name << "[" << flavor <<"]: " << temp[flavor] << " " << unit<< endl;
-  return temp[flavor];
-		
+	if (g_ip->print_detail_debug)
+	{
+		init(technology, is_tag);
+		return;
+	}
+
+	vector<double> key;
+	key.push_back(technology);
+	key.push_back(g_ip->F_sz_um);
+	key.push_back((is_tag) ? g_ip->tag_arr_ram_cell_tech_type : g_ip->data_arr_ram_cell_tech_type);
+	key.push_back((is_tag) ? g_ip->tag_arr_peri_global_tech_type : g_ip->data_arr_peri_global_tech_type);
+	key.push_back(g_ip->temp);
+	key.push_back(g_ip->ic_proj_type);
+	key.push_back(g_ip->wire_is_mat_type);
+	key.push_back(g_ip->wire_os_mat_type);
+	key.push_back(g_ip->tsv_is_subarray_type);
+	key.push_back(g_ip->tsv_os_bank_type);
+	key.push_back(g_ip->num_die_3d);
+
+	pthread_mutex_lock(&tech_param_lock);
+	map<vector<double>, TechnologyParameter>::const_iterator it = tech_params.find(key);
+	bool found = (it != tech_params.end());
+	if (found)
+	{
+		*this = it->second;
+	}
+	pthread_mutex_unlock(&tech_param_lock);
+	if (found)
+	{
+		return;
+	}
+
+	// init() reads g_tp while it runs, so it has to be the one initialized
+	init(technology, is_tag);
+	load_key = key;
+	pthread_mutex_lock(&tech_param_lock);
+	tech_params.insert(make_pair(key, *this));
+	pthread_mutex_unlock(&tech_param_lock);
 }
 
-void scan_five_input_double_temperature(char* line, const char* name, const char* unit_name, int flavor, unsigned int temperature, bool print, double & result)
+void TechDataFile::parse(FILE * fp)
 {
-  double temp[5];	
-  unsigned int thermal_temp;
-  char unit[300];
-  memset(unit,0,300);
-  sscanf(&line[strlen(name)], "%*[ \t]%s%*[ \t]%u%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf"
-		,unit,&thermal_temp,&(temp[0]),&(temp[1]),&(temp[2]),&(temp[3]), &(temp[4]) );
-		
- 
-  if(thermal_temp==(temperature-300))
+	char line[5000];
+
+	checksum = hash_bytes(NULL, 0);
+	while(fgets(line, sizeof(line), fp) != NULL)
+	{
+		char * p = line;
+		char * end;
+		checksum = hash_bytes(line, strlen(line), checksum);
+		while (isspace(*p)) p++;
+		if (*p == '\0')
+		  continue;
+
+		TechDataRow row;
+		end = p;
+		while (*end != '\0' && !isspace(*end)) end++;
+		row.name.assign(p, end);
+		p = end;
+
+		while (*p == ' ' || *p == '\t') p++;
+		end = p;
+		while (*end != '\0' && !isspace(*end)) end++;
+		row.unit.assign(p, end);
+		p = end;
+
+		while (*p == ' ' || *p == '\t')
+		{
+			while (*p == ' ' || *p == '\t') p++;
+			double v = strtod(p, &end);
+			if (end == p)
+			  break;
+			row.val.push_back(v);
+			p = end;
+		}
+
+		index[row.name].push_back(rows.size());
+		rows.push_back(row);
+	}
+}
+
+const TechDataRow * TechDataFile::find(const char * name) const
+{
+	map<string, vector<unsigned int> >::const_iterator it = index.find(name);
+	if (it == index.end())
+	  return NULL;
+	return &rows[it->second.back()];
+}
+
+const TechDataRow * TechDataFile::find(const char * name, int key) const
+{
+	map<string, vector<unsigned int> >::const_iterator it = index.find(name);
+	if (it == index.end())
+	  return NULL;
+	for (int i = it->second.size() - 1; i >= 0; i--)
+	{
+		const TechDataRow & row = rows[it->second[i]];
+		if (!row.val.empty() && (int) row.val[0] == key)
+		  return &row;
+	}
+	return NULL;
+}
+
+// Look up column "index" of parameter "name"; 0 if the file does not have it.
+double scan_input_double(const TechDataFile & tech, const char* name, int index, bool print)
+{
+	const TechDataRow * row = tech.find(name);
+	if (row == NULL || index < 0 || index >= (int) row->val.size())
+	  return 0;
+	if (print)
+		cout << name << " " << row->val[index] << " " << row->unit << endl;
+	return row->val[index];
+}
+
+double scan_single_input_double(const TechDataFile & tech, const char* name, bool print)
+{
+	return scan_input_double(tech, name, 0, print);
+}
+
+double scan_five_input_double(const TechDataFile & tech, const char* name, int flavor, bool print)
+{
+	return scan_input_double(tech, name, flavor, print);
+}
+
+void scan_five_input_double_temperature(const TechDataFile & tech, const char* name, int flavor, unsigned int temperature, bool print, double & result)
+{
+  const TechDataRow * row = tech.find(name, temperature-300);
+
+  if (row != NULL && flavor + 1 < (int) row->val.size())
   {
 	   if (print)
-					cout << name << ": " << temp[flavor] << " "<< unit << endl;
-			
-	result = temp[flavor];
+					cout << name << ": " << row->val[flavor + 1] << " "<< row->unit << endl;
+
+	result = row->val[flavor + 1];
   }
-		
 }
 
 void DeviceType::assign(const string & in_file, int tech_flavor,  unsigned int temperature)
 {
-	FILE *fp = fopen(in_file.c_str(), "r");
-	char line[5000];
-	//char temp_var[5000];
-
-	//double temp[5];
-	//unsigned int thermal_temp;
+	const TechDataFile & tech = TechDataFile::get(in_file);
+	bool print = g_ip->print_detail_debug;
 
 	double nmos_effective_resistance_multiplier;
 
-	if(!fp) {
-	cout << in_file << " is missing!\n";
-	exit(-1);
-	}
-
-	while(fscanf(fp, "%[^\n]\n", line) != EOF) 
-	{
-		if (!strncmp("-C_g_ideal", line, strlen("-C_g_ideal"))) 
-		{
-		  C_g_ideal=scan_five_input_double(line,"-C_g_ideal","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-C_fringe", line, strlen("-C_fringe"))) 
-		{
-		  C_fringe=scan_five_input_double(line,"-C_fringe","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-C_junc_sw", line, strlen("-C_junc_sw"))) 
-		{
-		  C_junc_sidewall =scan_five_input_double(line,"-C_junc_sw","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-C_junc", line, strlen("-C_junc"))) 
-		{
-		  C_junc=scan_five_input_double(line,"-C_junc","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		
-		if (!strncmp("-l_phy", line, strlen("-l_phy"))) 
-		{
-		  l_phy=scan_five_input_double(line,"-l_phy","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-l_elec", line, strlen("-l_elec"))) 
-		{
-		  l_elec=scan_five_input_double(line,"-l_elec","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-nmos_effective_resistance_multiplier", line, strlen("-nmos_effective_resistance_multiplier"))) 
-		{
-			nmos_effective_resistance_multiplier=scan_five_input_double(line,"-nmos_effective_resistance_multiplier","F/um",tech_flavor,g_ip->print_detail_debug);
-			continue;
-		}
-		if (!strncmp("-Vdd", line, strlen("-Vdd"))) 
-		{
-		  Vdd=scan_five_input_double(line,"-Vdd","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-Vth", line, strlen("-Vth"))) 
-		{
-		  Vth=scan_five_input_double(line,"-Vth","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-Vdsat", line, strlen("-Vdsat"))) 
-		{
-		  Vdsat=scan_five_input_double(line,"-Vdsat","V",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-I_on_n", line, strlen("-I_on_n"))) 
-		{
-		  I_on_n=scan_five_input_double(line,"-I_on_n","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-I_on_p", line, strlen("-I_on_p"))) 
-		{
-		  I_on_p = scan_five_input_double(line,"-I_on_p","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-I_off_n", line, strlen("-I_off_n"))) 
-		{
-		  scan_five_input_double_temperature(line,"-I_off_n","F/um",tech_flavor,temperature,g_ip->print_detail_debug,I_off_n);
-		  continue;
-		}
-		if (!strncmp("-I_g_on_n", line, strlen("-I_g_on_n"))) 
-		{
-		 scan_five_input_double_temperature(line,"-I_g_on_n","F/um",tech_flavor,temperature,g_ip->print_detail_debug,I_g_on_n);
-		  continue;
-		}
-		if (!strncmp("-C_ox", line, strlen("-C_ox"))) 
-		{
-		  C_ox=scan_five_input_double(line,"-C_ox","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-t_ox", line, strlen("-t_ox"))) 
-		{
-		  t_ox=scan_five_input_double(line,"-t_ox","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-n2p_drv_rt", line, strlen("-n2p_drv_rt"))) 
-		{
-		  n_to_p_eff_curr_drv_ratio=scan_five_input_double(line,"-n2p_drv_rt","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-lch_lk_rdc", line, strlen("-lch_lk_rdc"))) 
-		{
-		  long_channel_leakage_reduction=scan_five_input_double(line,"-lch_lk_rdc","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-Mobility_n", line, strlen("-Mobility_n"))) 
-		{
-		  Mobility_n=scan_five_input_double(line,"-Mobility_n","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-gmp_to_gmn_multiplier", line, strlen("-gmp_to_gmn_multiplier"))) 
-		{
-		  gmp_to_gmn_multiplier=scan_five_input_double(line,"-gmp_to_gmn_multiplier","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-n_to_p_eff_curr_drv_ratio", line, strlen("-n_to_p_eff_curr_drv_ratio"))) 
-		{
-		  n_to_p_eff_curr_drv_ratio=scan_five_input_double(line,"-n_to_p_eff_curr_drv_ratio","F/um",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		
-	} 
+	C_g_ideal = scan_five_input_double(tech,"-C_g_ideal",tech_flavor,print);
+	C_fringe = scan_five_input_double(tech,"-C_fringe",tech_flavor,print);
+	C_junc_sidewall = scan_five_input_double(tech,"-C_junc_sw",tech_flavor,print);
+	C_junc = scan_five_input_double(tech,"-C_junc",tech_flavor,print);
+	l_phy = scan_five_input_double(tech,"-l_phy",tech_flavor,print);
+	l_elec = scan_five_input_double(tech,"-l_elec",tech_flavor,print);
+	nmos_effective_resistance_multiplier = scan_five_input_double(tech,"-nmos_effective_resistance_multiplier",tech_flavor,print);
+	Vdd = scan_five_input_double(tech,"-Vdd",tech_flavor,print);
+	Vth = scan_five_input_double(tech,"-Vth",tech_flavor,print);
+	Vdsat = scan_five_input_double(tech,"-Vdsat",tech_flavor,print);
+	I_on_n = scan_five_input_double(tech,"-I_on_n",tech_flavor,print);
+	I_on_p = scan_five_input_double(tech,"-I_on_p",tech_flavor,print);
+	scan_five_input_double_temperature(tech,"-I_off_n",tech_flavor,temperature,print,I_off_n);
+	scan_five_input_double_temperature(tech,"-I_g_on_n",tech_flavor,temperature,print,I_g_on_n);
+	C_ox = scan_five_input_double(tech,"-C_ox",tech_flavor,print);
+	t_ox = scan_five_input_double(tech,"-t_ox",tech_flavor,print);
+	n_to_p_eff_curr_drv_ratio = scan_five_input_double(tech,"-n2p_drv_rt",tech_flavor,print);
+	long_channel_leakage_reduction = scan_five_input_double(tech,"-lch_lk_rdc",tech_flavor,print);
+	Mobility_n = scan_five_input_double(tech,"-Mobility_n",tech_flavor,print);
+	gmp_to_gmn_multiplier = scan_five_input_double(tech,"-gmp_to_gmn_multiplier",tech_flavor,print);
 
 	C_overlap = 0.2*C_g_ideal;
 	if(tech_flavor>=3)
@@ -323,9 +368,6 @@ void DeviceType::assign(const string & in_file, int tech_flavor,  unsigned int t
 		cout << "R_nch_on: " << R_nch_on << " ohm-micron" << endl;
 		cout << "R_pch_on: " << R_pch_on << " ohm-micron" << endl;
 	}
- 
-    fclose(fp);
-    
 }
 
 
@@ -361,113 +403,36 @@ void DeviceType::interpolate(double alpha, const DeviceType& dev1, const DeviceT
 }
 
 
-double scan_input_double_inter_type(char* line, const char * name, const char * unit_name, int proj_type, int tech_flavor, bool print)
+double scan_input_double_inter_type(const TechDataFile & tech, const char * name, int proj_type, int tech_flavor, bool print)
 {
 	assert(proj_type<NUMBER_INTERCONNECT_PROJECTION_TYPES);
 	int index = proj_type*NUMBER_WIRE_TYPES + tech_flavor;
 	//cout << name << " index: " << index << endl;
-	double temp[8];
-	char unit[300];
-	memset(unit,0,300);
-	sscanf(&line[strlen(name)], "%*[ \t]%s%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf"
-		,unit,&(temp[0]),&(temp[1]),&(temp[2]),&(temp[3]), &(temp[4]),&(temp[5]),&(temp[6]),&(temp[7]));
-		
-	if (print)
-		cout << name << " " << temp[index] << " " << unit << endl;
-  
-  return temp[index];
+	return scan_input_double(tech, name, index, print);
 }
 
 void InterconnectType::assign(const string & in_file, int projection_type, int tech_flavor)
 {
-	
-	FILE *fp = fopen(in_file.c_str(), "r");
-	char line[5000];
-	//char temp_var[5000];
-
-	//double temp[5];
-	//unsigned int thermal_temp;
-
-	//double nmos_effective_resistance_multiplier;
+	const TechDataFile & tech = TechDataFile::get(in_file);
 
 	double resistivity;
- 
-	if(!fp) {
-	cout << in_file << " is missing!\n";
-	exit(-1);
-	}
 
 	bool print = g_ip->print_detail_debug;
 
-	while(fscanf(fp, "%[^\n]\n", line) != EOF) 
-	{
-		if (!strncmp("-wire_pitch", line, strlen("-wire_pitch"))) 
-		{
-		  pitch =scan_input_double_inter_type(line,"-wire_pitch","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-barrier_thickness", line, strlen("-barrier_thickness"))) 
-		{
-		  barrier_thickness =scan_input_double_inter_type(line,"-barrier_thickness","ohm",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-dishing_thickness", line, strlen("-dishing_thickness"))) 
-		{
-		  dishing_thickness =scan_input_double_inter_type(line,"-dishing_thickness","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-alpha_scatter", line, strlen("-alpha_scatter"))) 
-		{
-		  alpha_scatter =scan_input_double_inter_type(line,"-alpha_scatter","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-aspect_ratio", line, strlen("-aspect_ratio"))) 
-		{
-		  aspect_ratio =scan_input_double_inter_type(line,"-aspect_ratio","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-miller_value", line, strlen("-miller_value"))) 
-		{
-		  miller_value =scan_input_double_inter_type(line,"-miller_value","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-horiz_dielectric_constant", line, strlen("-horiz_dielectric_constant"))) 
-		{
-		  horiz_dielectric_constant =scan_input_double_inter_type(line,"-horiz_dielectric_constant","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-vert_dielectric_constant", line, strlen("-vert_dielectric_constant"))) 
-		{
-		  vert_dielectric_constant =scan_input_double_inter_type(line,"-vert_dielectric_constant","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-ild_thickness", line, strlen("-ild_thickness"))) 
-		{
-		  ild_thickness =scan_input_double_inter_type(line,"-ild_thickness","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-fringe_cap", line, strlen("-fringe_cap"))) 
-		{
-		  fringe_cap =scan_input_double_inter_type(line,"-fringe_cap","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-wire_r_per_micron", line, strlen("-wire_r_per_micron"))) 
-		{
-		  R_per_um =scan_input_double_inter_type(line,"-wire_r_per_micron","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-wire_c_per_micron", line, strlen("-wire_c_per_micron"))) 
-		{
-		  C_per_um =scan_input_double_inter_type(line,"-wire_c_per_micron","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-		if (!strncmp("-resistivity", line, strlen("-resistivity"))) 
-		{
-		  resistivity =scan_input_double_inter_type(line,"-resistivity","um",g_ip->ic_proj_type,tech_flavor,print);
-		  continue;
-		}
-	}
-	
+	pitch = scan_input_double_inter_type(tech,"-wire_pitch",g_ip->ic_proj_type,tech_flavor,print);
+	barrier_thickness = scan_input_double_inter_type(tech,"-barrier_thickness",g_ip->ic_proj_type,tech_flavor,print);
+	dishing_thickness = scan_input_double_inter_type(tech,"-dishing_thickness",g_ip->ic_proj_type,tech_flavor,print);
+	alpha_scatter = scan_input_double_inter_type(tech,"-alpha_scatter",g_ip->ic_proj_type,tech_flavor,print);
+	aspect_ratio = scan_input_double_inter_type(tech,"-aspect_ratio",g_ip->ic_proj_type,tech_flavor,print);
+	miller_value = scan_input_double_inter_type(tech,"-miller_value",g_ip->ic_proj_type,tech_flavor,print);
+	horiz_dielectric_constant = scan_input_double_inter_type(tech,"-horiz_dielectric_constant",g_ip->ic_proj_type,tech_flavor,print);
+	vert_dielectric_constant = scan_input_double_inter_type(tech,"-vert_dielectric_constant",g_ip->ic_proj_type,tech_flavor,print);
+	ild_thickness = scan_input_double_inter_type(tech,"-ild_thickness",g_ip->ic_proj_type,tech_flavor,print);
+	fringe_cap = scan_input_double_inter_type(tech,"-fringe_cap",g_ip->ic_proj_type,tech_flavor,print);
+	R_per_um = scan_input_double_inter_type(tech,"-wire_r_per_micron",g_ip->ic_proj_type,tech_flavor,print);
+	C_per_um = scan_input_double_inter_type(tech,"-wire_c_per_micron",g_ip->ic_proj_type,tech_flavor,print);
+	resistivity = scan_input_double_inter_type(tech,"-resistivity",g_ip->ic_proj_type,tech_flavor,print);
+
 	pitch *= g_ip->F_sz_um;
 	wire_width = pitch/ 2; //micron
     wire_thickness = aspect_ratio * wire_width;//micron
@@ -490,7 +455,6 @@ void InterconnectType::assign(const string & in_file, int projection_type, int t
 				<< "," << vert_dielectric_constant << "," << fringe_cap << ")\n";
 			
 	}			
-	fclose(fp);
 }
 
 bool InterconnectType::isEqual(const InterconnectType & inter)
@@ -529,80 +493,35 @@ void InterconnectType::interpolate(double alpha, const InterconnectType & inter1
 	
 }
 
-void scan_five_input_double_mem_type(char* line, const char* name, const char* unit_name, int flavor, int cell_type, bool print, double & result)
+void scan_five_input_double_mem_type(const TechDataFile & tech, const char* name, int flavor, int cell_type, bool print, double & result)
 {
-  double temp[5];	
-  int cell_type_temp;
-  char unit[300];
-  memset(unit,0,300);
-  
-  sscanf(&line[strlen(name)], "%*[ \t]%s%*[ \t]%d%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf"
-		,unit,&cell_type_temp,&(temp[0]),&(temp[1]),&(temp[2]),&(temp[3]), &(temp[4]) );
-		
- 
-  if(cell_type_temp==cell_type)
+  const TechDataRow * row = tech.find(name, cell_type);
+
+  if (row != NULL && flavor + 1 < (int) row->val.size())
   {
 	   if (print)
-		cout << name << ": " << temp[flavor] << " "<< unit << endl;
-			
-	result = temp[flavor];
+		cout << name << ": " << row->val[flavor + 1] << " "<< row->unit << endl;
+
+	result = row->val[flavor + 1];
   }
 }
 
 // cell_type --> sram(0),cam(1),dram(2)
 void MemoryType::assign(const string & in_file, int tech_flavor, int cell_type) 
 {
-	FILE *fp = fopen(in_file.c_str(), "r");
-	char line[5000];
-	//char temp_var[5000];
-
-	//double temp;
-	//unsigned int thermal_temp;
+	const TechDataFile & tech = TechDataFile::get(in_file);
+	bool print = g_ip->print_detail_debug;
 
 	double vdd_cell,vdd;
-	
-	if(!fp) {
-	cout << in_file << " is missing!\n";
-	exit(-1);
-	}
-	while(fscanf(fp, "%[^\n]\n", line) != EOF) 
-	{
-		if (!strncmp("-Vdd", line, strlen("-Vdd"))) 
-		{
-		  vdd=scan_five_input_double(line,"-Vdd","V",tech_flavor,g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-vdd_cell", line, strlen("-vdd_cell"))) 
-		{
-		  scan_five_input_double_mem_type(line,"-vdd_cell","V",tech_flavor,cell_type, g_ip->print_detail_debug,vdd_cell);
-		  continue;
-		}
-		if (!strncmp("-Wmemcella", line, strlen("-Wmemcella"))) 
-		{
-		  scan_five_input_double_mem_type(line,"-Wmemcella","V",tech_flavor,cell_type, g_ip->print_detail_debug,cell_a_w);
-		  continue;
-		}
-		if (!strncmp("-Wmemcellpmos", line, strlen("-Wmemcellpmos"))) 
-		{
-		  scan_five_input_double_mem_type(line,"-Wmemcellpmos","V",tech_flavor,cell_type, g_ip->print_detail_debug,cell_pmos_w);
-		  continue;
-		}
-		if (!strncmp("-Wmemcellnmos", line, strlen("-Wmemcellnmos"))) 
-		{
-		  scan_five_input_double_mem_type(line,"-Wmemcellnmos","V",tech_flavor,cell_type, g_ip->print_detail_debug,cell_nmos_w);
-		  continue;
-		}
-		if (!strncmp("-area_cell", line, strlen("-area_cell"))) 
-		{
-		  scan_five_input_double_mem_type(line,"-area_cell","V",tech_flavor,cell_type, g_ip->print_detail_debug,area_cell);
-		  continue;
-		}
-		if (!strncmp("-asp_ratio_cell", line, strlen("-asp_ratio_cell"))) 
-		{
-		  scan_five_input_double_mem_type(line,"-asp_ratio_cell","V",tech_flavor,cell_type, g_ip->print_detail_debug,asp_ratio_cell);
-		  continue;
-		}
-	}
+
+	vdd = scan_five_input_double(tech,"-Vdd",tech_flavor,print);
+	scan_five_input_double_mem_type(tech,"-vdd_cell",tech_flavor,cell_type,print,vdd_cell);
+	scan_five_input_double_mem_type(tech,"-Wmemcella",tech_flavor,cell_type,print,cell_a_w);
+	scan_five_input_double_mem_type(tech,"-Wmemcellpmos",tech_flavor,cell_type,print,cell_pmos_w);
+	scan_five_input_double_mem_type(tech,"-Wmemcellnmos",tech_flavor,cell_type,print,cell_nmos_w);
+	scan_five_input_double_mem_type(tech,"-area_cell",tech_flavor,cell_type,print,area_cell);
+	scan_five_input_double_mem_type(tech,"-asp_ratio_cell",tech_flavor,cell_type,print,asp_ratio_cell);
+
 	if(cell_type!=2)
 		cell_a_w *= g_ip->F_sz_um;
 	cell_pmos_w *= g_ip->F_sz_um;
@@ -661,31 +580,10 @@ bool MemoryType::isEqual(const MemoryType & mem)
 
 void ScalingFactor::assign(const string & in_file)
 {
-	FILE *fp = fopen(in_file.c_str(), "r");
-	char line[5000];
-	//char temp_var[5000];
-	if(!fp) 
-	{
-		cout << in_file << " is missing!\n";
-		exit(-1);
-	}
-
-	while(fscanf(fp, "%[^\n]\n", line) != EOF) 
-	{
-		if (!strncmp("-logic_scaling_co_eff", line, strlen("-logic_scaling_co_eff"))) 
-		{
-		  logic_scaling_co_eff = scan_single_input_double(line,"-logic_scaling_co_eff","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-core_tx_density", line, strlen("-core_tx_density"))) 
-		{
-		  core_tx_density = scan_single_input_double(line,"-core_tx_density","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		
-	}
+	const TechDataFile & tech = TechDataFile::get(in_file);
 
-	fclose(fp);
+	logic_scaling_co_eff = scan_single_input_double(tech,"-logic_scaling_co_eff", g_ip->print_detail_debug);
+	core_tx_density = scan_single_input_double(tech,"-core_tx_density", g_ip->print_detail_debug);
 }
 
 void ScalingFactor::interpolate(double alpha, const ScalingFactor& dev1, const ScalingFactor& dev2)
@@ -702,7 +600,7 @@ bool ScalingFactor::isEqual(const ScalingFactor &  scal)
 	return true;
 }
 
-void TechnologyParameter::find_upper_and_lower_tech(double technology, int &tech_lo, string& in_file_lo, int &tech_hi, string& in_file_hi)
+bool TechnologyParameter::find_upper_and_lower_tech(double technology, int &tech_lo, string& in_file_lo, int &tech_hi, string& in_file_hi)
 {
 	if (technology < 181 && technology > 179)
 	{
@@ -792,31 +690,24 @@ void TechnologyParameter::find_upper_and_lower_tech(double technology, int &tech
 	**/
 	else
 	{
-		cout<<"Invalid technology nodes"<<endl;
-		exit(0);
+		return false;
 	}
+	return true;
 }
 
 
-double scan_input_double_tsv_type(char* line, const char * name, const char * unit_name, int proj_type, int tsv_type, bool print)
+double scan_input_double_tsv_type(const TechDataFile & tech, const char * name, int proj_type, int tsv_type, bool print)
 {
 	assert(proj_type<NUMBER_INTERCONNECT_PROJECTION_TYPES);
 	int index = proj_type*NUMBER_TSV_TYPES + tsv_type;
-	double temp[6];
-	char unit[300];
-	memset(unit,0,300);
-	sscanf(&line[strlen(name)], "%*[ \t]%s%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf%*[ \t]%lf"
-		,unit,&(temp[0]),&(temp[1]),&(temp[2]),&(temp[3]), &(temp[4]),&(temp[5]));
-		
-    if (print)
-		cout << name << ": " << temp[index] << " " << unit << endl;
-  return temp[index];
+	return scan_input_double(tech, name, index, print);
 }
 
 void TechnologyParameter::assign_tsv(const string & in_file)
 {
-	FILE *fp ;
-	char line[5000];
+	const TechDataFile & tech = TechDataFile::get(in_file);
+	bool print = g_ip->print_detail_debug;
+
 	for(int iter=0;iter<2;iter++) // 0:fine 1:coarse
 	{
 		int tsv_type;
@@ -828,70 +719,67 @@ void TechnologyParameter::assign_tsv(const string & in_file)
 		{
 			tsv_type = g_ip->tsv_os_bank_type;
 		}
-		fp = fopen(in_file.c_str(), "r");
-		while(fscanf(fp, "%[^\n]\n", line) != EOF) 
+		for(unsigned int r=0;r<tech.rows.size();r++)
 		{
-			if (!strncmp("-tsv_pitch", line, strlen("-tsv_pitch"))) 
+			const string & name = tech.rows[r].name;
+			if (name == "-tsv_pitch")
 			{
-			  tsv_pitch = scan_input_double_tsv_type(line,"-tsv_pitch","F/um", g_ip->ic_proj_type, tsv_type, g_ip->print_detail_debug);
+			  tsv_pitch = scan_input_double_tsv_type(tech,"-tsv_pitch", g_ip->ic_proj_type, tsv_type, print);
 			  continue;
 			}
-			if (!strncmp("-tsv_diameter", line, strlen("-tsv_diameter"))) 
+			if (name == "-tsv_diameter")
 			{
-			  tsv_diameter = scan_input_double_tsv_type(line,"-tsv_diameter","F/um", g_ip->ic_proj_type, tsv_type, g_ip->print_detail_debug);
+			  tsv_diameter = scan_input_double_tsv_type(tech,"-tsv_diameter", g_ip->ic_proj_type, tsv_type, print);
 			  continue;
 			}
-			if (!strncmp("-tsv_length", line, strlen("-tsv_length"))) 
+			if (name == "-tsv_length")
 			{
-			  tsv_length = scan_input_double_tsv_type(line,"-tsv_length","F/um", g_ip->ic_proj_type, tsv_type, g_ip->print_detail_debug);
+			  tsv_length = scan_input_double_tsv_type(tech,"-tsv_length", g_ip->ic_proj_type, tsv_type, print);
 			  continue;
 			}
-			if (!strncmp("-tsv_dielec_thickness", line, strlen("-tsv_dielec_thickness"))) 
+			if (name == "-tsv_dielec_thickness")
 			{
-			  tsv_dielec_thickness = scan_input_double_tsv_type(line,"-tsv_dielec_thickness","F/um", g_ip->ic_proj_type, tsv_type, g_ip->print_detail_debug);
+			  tsv_dielec_thickness = scan_input_double_tsv_type(tech,"-tsv_dielec_thickness", g_ip->ic_proj_type, tsv_type, print);
 			  continue;
 			}
-			if (!strncmp("-tsv_contact_resistance", line, strlen("-tsv_contact_resistance"))) 
+			if (name == "-tsv_contact_resistance")
 			{
-			  tsv_contact_resistance = scan_input_double_tsv_type(line,"-tsv_contact_resistance","F/um", g_ip->ic_proj_type, tsv_type, g_ip->print_detail_debug);
+			  tsv_contact_resistance = scan_input_double_tsv_type(tech,"-tsv_contact_resistance", g_ip->ic_proj_type, tsv_type, print);
 			  continue;
 			}
-			if (!strncmp("-tsv_depletion_width", line, strlen("-tsv_depletion_width"))) 
+			if (name == "-tsv_depletion_width")
 			{
-			  tsv_depletion_width = scan_input_double_tsv_type(line,"-tsv_depletion_width","F/um", g_ip->ic_proj_type, tsv_type, g_ip->print_detail_debug);
+			  tsv_depletion_width = scan_input_double_tsv_type(tech,"-tsv_depletion_width", g_ip->ic_proj_type, tsv_type, print);
 			  continue;
 			}
-			if (!strncmp("-tsv_liner_dielectric_cons", line, strlen("-tsv_liner_dielectric_cons"))) 
+			if (name == "-tsv_liner_dielectric_cons")
 			{
-			  tsv_liner_dielectric_constant = scan_input_double_tsv_type(line,"-tsv_liner_dielectric_cons","F/um", g_ip->ic_proj_type, tsv_type, g_ip->print_detail_debug);
+			  tsv_liner_dielectric_constant = scan_input_double_tsv_type(tech,"-tsv_liner_dielectric_cons", g_ip->ic_proj_type, tsv_type, print);
 			  continue;
 			}
-			
-			tsv_length *= g_ip->num_die_3d;
-			if(iter==0)
-			{
-				tsv_parasitic_resistance_fine = tsv_resistance(BULK_CU_RESISTIVITY, tsv_length, tsv_diameter, tsv_contact_resistance);
-				tsv_parasitic_capacitance_fine = tsv_capacitance(tsv_length, tsv_diameter, tsv_pitch, tsv_dielec_thickness, tsv_liner_dielectric_constant, tsv_depletion_width);
-				tsv_minimum_area_fine = tsv_area(tsv_pitch);
-			}
-			else
-			{
-				tsv_parasitic_resistance_coarse = tsv_resistance(BULK_CU_RESISTIVITY, tsv_length, tsv_diameter, tsv_contact_resistance);
-				tsv_parasitic_capacitance_coarse = tsv_capacitance(tsv_length, tsv_diameter, tsv_pitch, tsv_dielec_thickness, tsv_liner_dielectric_constant, tsv_depletion_width);
-				tsv_minimum_area_coarse = tsv_area(tsv_pitch);
-			}
 		}
-		
-		fclose(fp);
+
+		// a TSV runs through the whole stack
+		tsv_length *= g_ip->num_die_3d;
+		if(iter==0)
+		{
+			tsv_parasitic_resistance_fine = tsv_resistance(BULK_CU_RESISTIVITY, tsv_length, tsv_diameter, tsv_contact_resistance);
+			tsv_parasitic_capacitance_fine = tsv_capacitance(tsv_length, tsv_diameter, tsv_pitch, tsv_dielec_thickness, tsv_liner_dielectric_constant, tsv_depletion_width);
+			tsv_minimum_area_fine = tsv_area(tsv_pitch);
+		}
+		else
+		{
+			tsv_parasitic_resistance_coarse = tsv_resistance(BULK_CU_RESISTIVITY, tsv_length, tsv_diameter, tsv_contact_resistance);
+			tsv_parasitic_capacitance_coarse = tsv_capacitance(tsv_length, tsv_diameter, tsv_pitch, tsv_dielec_thickness, tsv_liner_dielectric_constant, tsv_depletion_width);
+			tsv_minimum_area_coarse = tsv_area(tsv_pitch);
+		}
 	}
 }
 
+
 void TechnologyParameter::init(double technology, bool is_tag)
 {
-	FILE *fp ;
 	reset();
-	char line[5000];
-	//char temp_var[5000];
 	
 	uint32_t ram_cell_tech_type    = (is_tag) ? g_ip->tag_arr_ram_cell_tech_type : g_ip->data_arr_ram_cell_tech_type;
     uint32_t peri_global_tech_type = (is_tag) ? g_ip->tag_arr_peri_global_tech_type : g_ip->data_arr_peri_global_tech_type;
@@ -906,7 +794,11 @@ void TechnologyParameter::init(double technology, bool is_tag)
 
 	technology  = technology * 1000.0;  // in the unit of nm
 	
-	find_upper_and_lower_tech(technology, tech_lo,in_file_lo,tech_hi,in_file_hi);
+	if (!find_upper_and_lower_tech(technology, tech_lo,in_file_lo,tech_hi,in_file_hi))
+	{
+		cout<<"Invalid technology nodes"<<endl;
+		exit(0);
+	}
 	// excluding some cases.
 	if((tech_lo==22) && (tech_hi==22))
 	{
@@ -926,59 +818,18 @@ void TechnologyParameter::init(double technology, bool is_tag)
 		alpha = (technology - tech_hi)/(tech_lo - tech_hi);
 	}
 	
-	fp = fopen(in_file_lo.c_str(), "r");
-	dram_cell_I_on = 0;
-	dram_cell_Vdd = 0;
-	dram_cell_C = 0;
-	dram_cell_I_off_worst_case_len_temp = 0;
-	vpp = 0 ;
-	macro_layout_overhead = 0;
-	chip_layout_overhead =0;
-	sckt_co_eff = 0;
-	while(fscanf(fp, "%[^\n]\n", line) != EOF) 
-	{
-		if (!strncmp("-dram_cell_I_on", line, strlen("-dram_cell_I_on"))) 
-		{
-		  dram_cell_I_on += alpha*scan_five_input_double(line,"-dram_cell_I_on","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-dram_cell_Vdd", line, strlen("-dram_cell_Vdd"))) 
-		{
-		  dram_cell_Vdd += alpha* scan_five_input_double(line,"-dram_cell_Vdd","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-dram_cell_C", line, strlen("-dram_cell_C"))) 
-		{
-		  dram_cell_C += alpha* scan_five_input_double(line,"-dram_cell_C","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-dram_cell_I_off_worst_case_len_temp", line, strlen("-dram_cell_I_off_worst_case_len_temp"))) 
-		{
-		  dram_cell_I_off_worst_case_len_temp += alpha* scan_five_input_double(line,"-dram_cell_I_off_worst_case_len_temp","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-vpp", line, strlen("-vpp"))) 
-		{
-		  vpp += alpha* scan_five_input_double(line,"-vpp","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-sckt_co_eff", line, strlen("-sckt_co_eff"))) 
-		{
-		  sckt_co_eff += alpha * scan_single_input_double(line,"-sckt_co_eff","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-chip_layout_overhead", line, strlen("-chip_layout_overhead"))) 
-		{
-		  chip_layout_overhead += alpha * scan_single_input_double(line,"-chip_layout_overhead","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-macro_layout_overhead", line, strlen("-macro_layout_overhead"))) 
-		{
-		  macro_layout_overhead += alpha * scan_single_input_double(line,"-macro_layout_overhead","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-	}
-	fclose(fp);
+	const TechDataFile & tech_lo_file = TechDataFile::get(in_file_lo);
+	const TechDataFile & tech_hi_file = TechDataFile::get(in_file_hi);
+	bool print = g_ip->print_detail_debug;
+
+	dram_cell_I_on = alpha*scan_five_input_double(tech_lo_file,"-dram_cell_I_on", ram_cell_tech_type, print);
+	dram_cell_Vdd = alpha*scan_five_input_double(tech_lo_file,"-dram_cell_Vdd", ram_cell_tech_type, print);
+	dram_cell_C = alpha*scan_five_input_double(tech_lo_file,"-dram_cell_C", ram_cell_tech_type, print);
+	dram_cell_I_off_worst_case_len_temp = alpha*scan_five_input_double(tech_lo_file,"-dram_cell_I_off_worst_case_len_temp", ram_cell_tech_type, print);
+	vpp = alpha*scan_five_input_double(tech_lo_file,"-vpp", ram_cell_tech_type, print);
+	sckt_co_eff = alpha*scan_single_input_double(tech_lo_file,"-sckt_co_eff", print);
+	chip_layout_overhead = alpha*scan_single_input_double(tech_lo_file,"-chip_layout_overhead", print);
+	macro_layout_overhead = alpha*scan_single_input_double(tech_lo_file,"-macro_layout_overhead", print);
 	
 	
 	DeviceType peri_global_lo, peri_global_hi;
@@ -1114,62 +965,16 @@ void TechnologyParameter::init(double technology, bool is_tag)
 	
 	
 	
-	fp = fopen(in_file_hi.c_str(), "r");
-	
-	while(fscanf(fp, "%[^\n]\n", line) != EOF) 
-	{
-		if (!strncmp("-sense_delay", line, strlen("-sense_delay"))) 
-		{
-		  sense_delay = scan_single_input_double(line,"-sense_delay","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-sense_dy_power", line, strlen("-sense_dy_power"))) 
-		{
-		  sense_dy_power = scan_single_input_double(line,"-sense_dy_power","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-sckt_co_eff", line, strlen("-sckt_co_eff"))) 
-		{
-		  sckt_co_eff += (1-alpha)* scan_single_input_double(line,"-sckt_co_eff","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-chip_layout_overhead", line, strlen("-chip_layout_overhead"))) 
-		{
-		  chip_layout_overhead += (1-alpha)* scan_single_input_double(line,"-chip_layout_overhead","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-macro_layout_overhead", line, strlen("-macro_layout_overhead"))) 
-		{
-		  macro_layout_overhead += (1-alpha)* scan_single_input_double(line,"-macro_layout_overhead","F/um", g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-dram_cell_I_on", line, strlen("-dram_cell_I_on"))) 
-		{
-		  dram_cell_I_on += (1-alpha) * scan_five_input_double(line,"-dram_cell_I_on","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-dram_cell_Vdd", line, strlen("-dram_cell_Vdd"))) 
-		{
-		  dram_cell_Vdd += (1-alpha) * scan_five_input_double(line,"-dram_cell_Vdd","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-dram_cell_C", line, strlen("-dram_cell_C"))) 
-		{
-		  dram_cell_C += (1-alpha) * scan_five_input_double(line,"-dram_cell_C","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-dram_cell_I_off_worst_case_len_temp", line, strlen("-dram_cell_I_off_worst_case_len_temp"))) 
-		{
-		  dram_cell_I_off_worst_case_len_temp += (1-alpha) * scan_five_input_double(line,"-dram_cell_I_off_worst_case_len_temp","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-		if (!strncmp("-vpp", line, strlen("-vpp"))) 
-		{
-		  vpp += (1-alpha)* scan_five_input_double(line,"-vpp","F/um", ram_cell_tech_type, g_ip->print_detail_debug);
-		  continue;
-		}
-	}
-	fclose(fp);
+	sense_delay = scan_single_input_double(tech_hi_file,"-sense_delay", print);
+	sense_dy_power = scan_single_input_double(tech_hi_file,"-sense_dy_power", print);
+	sckt_co_eff += (1-alpha)*scan_single_input_double(tech_hi_file,"-sckt_co_eff", print);
+	chip_layout_overhead += (1-alpha)*scan_single_input_double(tech_hi_file,"-chip_layout_overhead", print);
+	macro_layout_overhead += (1-alpha)*scan_single_input_double(tech_hi_file,"-macro_layout_overhead", print);
+	dram_cell_I_on += (1-alpha)*scan_five_input_double(tech_hi_file,"-dram_cell_I_on", ram_cell_tech_type, print);
+	dram_cell_Vdd += (1-alpha)*scan_five_input_double(tech_hi_file,"-dram_cell_Vdd", ram_cell_tech_type, print);
+	dram_cell_C += (1-alpha)*scan_five_input_double(tech_hi_file,"-dram_cell_C", ram_cell_tech_type, print);
+	dram_cell_I_off_worst_case_len_temp += (1-alpha)*scan_five_input_double(tech_hi_file,"-dram_cell_I_off_worst_case_len_temp", ram_cell_tech_type, print);
+	vpp += (1-alpha)*scan_five_input_double(tech_hi_file,"-vpp", ram_cell_tech_type, print);
 	
 	//Currently we are not modeling the resistance/capacitance of poly anywhere.
 	//Continuous function (or date have been processed) does not need linear interpolation
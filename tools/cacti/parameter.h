@@ -39,6 +39,9 @@
 #include "cacti_interface.h"
 #include "io.h"
 
+#include <map>
+#include <vector>
+
 // parameters which are functions of certain device technology
 /**
 class TechnologyParameter
@@ -302,6 +305,39 @@ class TechnologyParameter
 };
 
 **/
+
+// One line of a tech_params/*.dat file: "<name> <unit> <value> <value> ..."
+struct TechDataRow
+{
+	string name;
+	string unit;
+	vector<double> val;
+};
+
+// A tech_params/*.dat file, parsed the first time it is needed and kept in
+// memory for the rest of the run. Rows stay in file order and are indexed
+// by parameter name; temperature and memory cell tables have several rows
+// per parameter, told apart by their first column.
+class TechDataFile
+{
+	public:
+	vector<TechDataRow> rows;
+	uint64_t checksum;  // of the file contents
+
+	TechDataFile() : checksum(0) { }
+
+	static const TechDataFile & get(const string & in_file);
+
+	// last row of the parameter (and with the given first column), or NULL
+	const TechDataRow * find(const char * name) const;
+	const TechDataRow * find(const char * name, int key) const;
+
+	private:
+	map<string, vector<unsigned int> > index;
+
+	void parse(FILE * fp);
+};
+
 //ali
 class DeviceType
 {
@@ -582,9 +618,15 @@ class TechnologyParameter
   bool isEqual(const TechnologyParameter & tech);
   
   
-  void find_upper_and_lower_tech(double technology, int &tech_lo, string& in_file_lo, int &tech_hi, string& in_file_hi);
+  // tech files bracketing the node (in nm); false if it is not supported
+  bool find_upper_and_lower_tech(double technology, int &tech_lo, string& in_file_lo, int &tech_hi, string& in_file_hi);
   void assign_tsv(const string & in_file);
   void init(double technology, bool is_tag);
+  // same as init() on g_tp, but an earlier result for the same inputs is
+  // copied instead of being interpolated again
+  void load(double technology, bool is_tag);
+  // inputs load() cached this parameter set under; empty if it is not cached
+  vector<double> load_key;
   TechnologyParameter()
   {
 	  reset();
@@ -680,7 +722,7 @@ class TechnologyParameter
     dram.reset();
     cam.reset();
 
-    
+    load_key.clear();
   }
 };
 
@@ -772,8 +814,41 @@ class DynamicParameter
 
 
 
-extern InputParameter * g_ip;
-extern TechnologyParameter g_tp;
+class WireTables;
+class solve_candidates;
+
+// Everything one solve reads and writes: the input parameters, the
+// technology tables derived from them and the repeated-wire models.
+// g_ip and g_tp name the context bound to the calling thread, so
+// independent configurations can be solved concurrently by giving each
+// thread its own context. Threads start out bound to a shared default
+// context, and thread pool workers run tasks in the context of the thread
+// that submitted them.
+class SolverContext
+{
+  public:
+    SolverContext(InputParameter * ip = NULL);
+    ~SolverContext();
+
+    InputParameter    * ip;
+    TechnologyParameter tp;
+    WireTables        * wire;
+    // candidates of the last solve(), for rerank_solve()
+    solve_candidates  * last_solve;
+
+    // make this context current on the calling thread; returns the
+    // previously bound one so the caller can restore it.
+    SolverContext * bind();
+
+  private:
+    SolverContext(const SolverContext &);
+    SolverContext & operator=(const SolverContext &);
+};
+
+extern __thread SolverContext * g_ctx;
+
+#define g_ip (g_ctx->ip)
+#define g_tp (g_ctx->tp)
 
 #endif
 
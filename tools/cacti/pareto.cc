@@ -0,0 +1,310 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#include <pthread.h>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "pareto.h"
+#include "parameter.h"
+#include "Ucache.h"
+#include "nuca.h"
+
+using namespace std;
+
+
+string ParetoFront::file_name;
+
+// fronts of concurrent solves are appended whole
+static pthread_mutex_t pareto_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const char * wire_type_name[] = {
+  "Global", "Global_5", "Global_10", "Global_20", "Global_30", "Low_swing",
+  "Semi_global", "Full_swing", "Transmission", "Optical"
+};
+
+
+
+array_org::array_org(const mem_array * m)
+  : valid(m != NULL)
+{
+  if (m != NULL)
+  {
+    Ndwl = m->Ndwl;
+    Ndbl = m->Ndbl;
+    Nspd = m->Nspd;
+    Ndcm = m->deg_bl_muxing;
+    Ndsam_lev_1 = m->Ndsam_lev_1;
+    Ndsam_lev_2 = m->Ndsam_lev_2;
+    wt = m->wt;
+  }
+}
+
+
+
+static double uca_org_cost::* const metric[] = {
+  &uca_org_cost::access_time, &uca_org_cost::cycle_time, &uca_org_cost::dyn,
+  &uca_org_cost::leakage, &uca_org_cost::area
+};
+#define N_METRICS (sizeof(metric)/sizeof(metric[0]))
+
+// Static k-d tree over the points. The node of range [lo, hi) of idx is its
+// median, at (lo + hi) / 2, split by metric depth % N_METRICS; least holds
+// the least of every metric in its subtree, so subtrees without a point
+// that could dominate a given one are skipped.
+struct front_tree
+{
+  const vector<uca_org_cost> & cost;
+  vector<uint32_t>             idx;
+  vector<uca_org_cost>         least;
+
+  front_tree(const vector<uca_org_cost> & c) : cost(c), idx(c.size()), least(c.size()) { }
+};
+
+struct metric_lt
+{
+  const vector<uca_org_cost> & cost;
+  double uca_org_cost::*       m;
+
+  metric_lt(const vector<uca_org_cost> & c, double uca_org_cost::* m_) : cost(c), m(m_) { }
+  bool operator()(uint32_t a, uint32_t b) const
+  {
+    return cost[a].*m < cost[b].*m || (cost[a].*m == cost[b].*m && a < b);
+  }
+};
+
+
+
+static void build_tree(front_tree & t, uint32_t lo, uint32_t hi, uint32_t depth)
+{
+  if (lo >= hi)
+  {
+    return;
+  }
+  uint32_t mid = (lo + hi) / 2;
+  nth_element(t.idx.begin() + lo, t.idx.begin() + mid, t.idx.begin() + hi,
+              metric_lt(t.cost, metric[depth % N_METRICS]));
+  build_tree(t, lo, mid, depth + 1);
+  build_tree(t, mid + 1, hi, depth + 1);
+
+  uca_org_cost & l = t.least[mid];
+  l = t.cost[t.idx[mid]];
+  for (uint32_t k = 0; k < N_METRICS; k++)
+  {
+    if (lo < mid)
+    {
+      l.*metric[k] = MIN(l.*metric[k], t.least[(lo + mid) / 2].*metric[k]);
+    }
+    if (mid + 1 < hi)
+    {
+      l.*metric[k] = MIN(l.*metric[k], t.least[(mid + 1 + hi) / 2].*metric[k]);
+    }
+  }
+}
+
+
+
+// Whether a point in [lo, hi) other than i dominates point i; of equal
+// points the first dominates the others.
+static bool dominated(const front_tree & t, uint32_t lo, uint32_t hi, uint32_t depth, uint32_t i)
+{
+  if (lo >= hi)
+  {
+    return false;
+  }
+  uint32_t             mid = (lo + hi) / 2;
+  uint32_t             j   = t.idx[mid];
+  const uca_org_cost & c   = t.cost[i];
+  if (!t.least[mid].dominates(c))
+  {
+    return false;
+  }
+  if (j != i && t.cost[j].dominates(c) && (j < i || !c.dominates(t.cost[j])))
+  {
+    return true;
+  }
+  double uca_org_cost::* m = metric[depth % N_METRICS];
+  return dominated(t, lo, mid, depth + 1, i) ||
+         (t.cost[j].*m <= c.*m && dominated(t, mid + 1, hi, depth + 1, i));
+}
+
+
+
+// Indices, in increasing order, of the points no other point dominates; of
+// equal points only the first is kept.
+static vector<uint32_t> pareto_front(const vector<uca_org_cost> & cost)
+{
+  front_tree t(cost);
+  for (uint32_t i = 0; i < cost.size(); i++)
+  {
+    t.idx[i] = i;
+  }
+  build_tree(t, 0, cost.size(), 0);
+
+  vector<uint32_t> front;
+  for (uint32_t i = 0; i < cost.size(); i++)
+  {
+    if (!dominated(t, 0, cost.size(), 0, i))
+    {
+      front.push_back(i);
+    }
+  }
+  return front;
+}
+
+
+
+static void print_org(ostream & os, const array_org & org)
+{
+  if (org.valid)
+  {
+    os << org.Ndwl << ", " << org.Ndbl << ", " << org.Nspd << ", " << org.Ndcm << ", "
+       << org.Ndsam_lev_1 << ", " << org.Ndsam_lev_2 << ", "
+       << ((org.wt >= Global && org.wt < Invalid_wtype) ? wire_type_name[org.wt] : "N/A");
+  }
+  else
+  {
+    os << "N/A, N/A, N/A, N/A, N/A, N/A, N/A";
+  }
+}
+
+
+
+static void print_config(ostream & os, const char * kind, double cache_sz)
+{
+  os << kind << ", " << g_ip->F_sz_nm << ", " << cache_sz << ", "
+     << g_ip->block_sz << ", " << g_ip->tag_assoc << ", ";
+}
+
+
+
+static void append(const string & rows, const string & name)
+{
+  pthread_mutex_lock(&pareto_lock);
+  ofstream file(name.c_str(), ios::app);
+  file << rows;
+  file.close();
+  pthread_mutex_unlock(&pareto_lock);
+}
+
+
+
+void ParetoFront::set_file(const string & name)
+{
+  file_name = name;
+
+  ofstream file(file_name.c_str(), ios::trunc);
+  if (!file.is_open())
+  {
+    cerr << "Pareto front file " << file_name << " could not be opened successfully" << endl;
+    exit(1);
+  }
+  file << "Kind, Tech node (nm), Capacity (bytes), Block size (bytes), Associativity, "
+       << "Access time (ns), Cycle time (ns), Dynamic read energy (nJ), "
+       << "Leakage power (mW), Area (mm2), "
+       << "Banks, Grid rows, Grid columns, Network wire, Router type, "
+       << "Data Ndwl, Data Ndbl, Data Nspd, Data Ndcm, Data Ndsam_lev_1, Data Ndsam_lev_2, Data wire, "
+       << "Tag Ndwl, Tag Ndbl, Tag Nspd, Tag Ndcm, Tag Ndsam_lev_1, Tag Ndsam_lev_2, Tag wire" << endl;
+  file.close();
+}
+
+
+
+void ParetoFront::write(const uca_combine_struct & comb)
+{
+  vector<uint32_t>     org;
+  vector<uca_org_cost> cost;
+  for (uint32_t c = 0; c < comb.kept.size(); c++)
+  {
+    org.insert(org.end(), comb.kept[c].begin(), comb.kept[c].end());
+    cost.insert(cost.end(), comb.cost[c].begin(), comb.cost[c].end());
+  }
+
+  vector<uint32_t> front = pareto_front(cost);
+  ostringstream rows;
+  for (uint32_t k = 0; k < front.size(); k++)
+  {
+    const uca_org_cost & u = cost[front[k]];
+    uint32_t             i = org[front[k]];
+    print_config(rows, "UCA", g_ip->cache_sz);
+    rows << u.access_time*1e+9 << ", " << u.cycle_time*1e+9 << ", "
+         << u.dyn*1e+9 << ", " << u.leakage*1e+3 << ", " << u.area*1e-6 << ", "
+         << g_ip->nbanks << ", N/A, N/A, N/A, N/A, ";
+    print_org(rows, array_org(comb.data[i % comb.data.size()]));
+    rows << ", ";
+    print_org(rows, array_org(comb.tag[i / comb.data.size()]));
+    rows << endl;
+  }
+  append(rows.str(), file_name);
+}
+
+
+
+// NUCA access and cycle times are in network cycles of the router's clock
+// (in ps); they are written in ns.
+void ParetoFront::write(const list<nuca_org_t *> & nlist)
+{
+  vector<const nuca_org_t *> org;
+  vector<uca_org_cost>       cost;
+  for (list<nuca_org_t *>::const_iterator it = nlist.begin(); it != nlist.end(); ++it)
+  {
+    const Component & pda = (*it)->nuca_pda;
+    uca_org_cost c = { pda.delay, pda.cycle_time, pda.power.readOp.dynamic,
+                       pda.power.readOp.leakage, pda.area.get_area() };
+    org.push_back(*it);
+    cost.push_back(c);
+  }
+
+  vector<uint32_t> front = pareto_front(cost);
+  ostringstream rows;
+  for (uint32_t k = 0; k < front.size(); k++)
+  {
+    const nuca_org_t & n = *org[front[k]];
+    const Component & pda = n.nuca_pda;
+    print_config(rows, "NUCA", g_ip->nuca_cache_sz);
+    rows << pda.delay*pda.cycle_time*1e-3 << ", " << pda.cycle_time*1e-3 << ", "
+         << pda.power.readOp.dynamic*1e+9 << ", " << pda.power.readOp.leakage*1e+3 << ", "
+         << pda.area.get_area()*1e-6 << ", "
+         << n.bank_count << ", " << n.rows << ", " << n.columns << ", "
+         << wire_type_name[n.h_wire->wt] << ", " << n.router_type << ", ";
+    print_org(rows, n.bank_data);
+    rows << ", ";
+    print_org(rows, n.bank_tag);
+    rows << endl;
+  }
+  append(rows.str(), file_name);
+}
@@ -0,0 +1,88 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#ifndef __PARETO_H__
+#define __PARETO_H__
+
+#include <list>
+#include <string>
+#include "cacti_interface.h"
+
+using namespace std;
+
+class nuca_org_t;
+struct uca_combine_struct;
+
+
+// Partition of one array, as listed with each point of a front.
+struct array_org
+{
+  bool      valid;
+  int       Ndwl;
+  int       Ndbl;
+  double    Nspd;
+  int       Ndcm;
+  int       Ndsam_lev_1;
+  int       Ndsam_lev_2;
+  Wire_type wt;
+
+  array_org() : valid(false) { }
+  array_org(const mem_array * m);
+};
+
+
+
+// Pareto-front output. With a file set, solve() and find_optimal_nuca() add
+// to it every organization they may choose from, under any weights and
+// deviation limits, that no other one beats in all of access time, cycle
+// time, dynamic read energy, leakage and area. Points are csv rows carrying
+// the array partitions, so the choice under other weights can be made
+// offline.
+class ParetoFront
+{
+  public:
+    // truncates the file and writes the csv header
+    static void set_file(const string & name);
+    static bool enabled() { return !file_name.empty(); }
+
+    // the organizations left in comb.kept and comb.cost by combine_tag_data()'s
+    // evaluation step
+    static void write(const uca_combine_struct & comb);
+    static void write(const list<nuca_org_t *> & nlist);
+
+  private:
+    static string file_name;
+};
+
+#endif
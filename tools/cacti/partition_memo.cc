@@ -0,0 +1,351 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#include "partition_memo.h"
+#include "parameter.h"
+#include "basic_circuit.h"
+#include "Ucache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+
+// bump when calculate_time() or the file layout changes meaning
+#define MEMO_VERSION 3
+static const char memo_magic[8] = {'C', 'A', 'C', 'T', 'I', 'M', 'E', 'M'};
+
+// upper bound on the length of a packed mem_array
+#define MEMO_MAX_WORDS ((sizeof(mem_array) + 7) / 8 + (sizeof(mem_array) + 511) / 512)
+
+string PartitionMemo::dir;
+
+
+void PartitionMemo::set_dir(const string & d)
+{
+  dir = d;
+
+  // create dir and any missing parents, like mkdir -p
+  for (size_t pos = 1; pos <= dir.size(); pos++)
+  {
+    if (pos == dir.size() || dir[pos] == '/')
+    {
+      string part = dir.substr(0, pos);
+      if (mkdir(part.c_str(), 0777) != 0 && errno != EEXIST)
+      {
+        cerr << "Memo directory " << part << " could not be created: " << strerror(errno) << endl;
+        exit(1);
+      }
+    }
+  }
+
+  struct stat st;
+  if (stat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode))
+  {
+    cerr << "Memo directory " << dir << " is not a directory" << endl;
+    exit(1);
+  }
+}
+
+
+
+template <class T>
+static void mix(uint64_t & h, T v)
+{
+  h = hash_bytes(&v, sizeof(v), h);
+}
+
+template <class T>
+static void mix(uint64_t & h, const vector<T> & v)
+{
+  mix(h, v.size());
+  if (!v.empty())
+  {
+    h = hash_bytes(&v[0], v.size() * sizeof(T), h);
+  }
+}
+
+// Everything the sweep reads from the inputs: all InputParameter fields
+// except the optimization targets, print flags and the NUCA, MemCAD and
+// off-chip IO settings, the tech files of the node and the candidates.
+uint64_t PartitionMemo::input_key(const InputParameter & ip)
+{
+  uint64_t h = hash_bytes(NULL, 0);
+
+  mix(h, MEMO_VERSION);
+  mix(h, sizeof(mem_array));
+
+  mix(h, ip.cache_sz);
+  mix(h, ip.line_sz);
+  mix(h, ip.assoc);
+  mix(h, ip.nbanks);
+  mix(h, ip.out_w);
+  mix(h, ip.specific_tag);
+  mix(h, ip.tag_w);
+  mix(h, ip.access_mode);
+  mix(h, ip.obj_func_dyn_energy);
+  mix(h, ip.obj_func_dyn_power);
+  mix(h, ip.obj_func_leak_power);
+  mix(h, ip.obj_func_cycle_t);
+  mix(h, ip.F_sz_nm);
+  mix(h, ip.F_sz_um);
+  mix(h, ip.num_rw_ports);
+  mix(h, ip.num_rd_ports);
+  mix(h, ip.num_wr_ports);
+  mix(h, ip.num_se_rd_ports);
+  mix(h, ip.num_search_ports);
+  mix(h, ip.is_main_mem);
+  mix(h, ip.is_3d_mem);
+  mix(h, ip.is_cache);
+  mix(h, ip.pure_ram);
+  mix(h, ip.pure_cam);
+  mix(h, ip.rpters_in_htree);
+  mix(h, ip.ver_htree_wires_over_array);
+  mix(h, ip.broadcast_addr_din_over_ver_htrees);
+  mix(h, ip.temp);
+  mix(h, ip.ram_cell_tech_type);
+  mix(h, ip.peri_global_tech_type);
+  mix(h, ip.data_arr_ram_cell_tech_type);
+  mix(h, ip.data_arr_peri_global_tech_type);
+  mix(h, ip.tag_arr_ram_cell_tech_type);
+  mix(h, ip.tag_arr_peri_global_tech_type);
+  mix(h, ip.burst_len);
+  mix(h, ip.int_prefetch_w);
+  mix(h, ip.page_sz_bits);
+  mix(h, ip.num_die_3d);
+  mix(h, ip.burst_depth);
+  mix(h, ip.io_width);
+  mix(h, ip.sys_freq_MHz);
+  mix(h, ip.tsv_is_subarray_type);
+  mix(h, ip.tsv_os_bank_type);
+  mix(h, ip.TSV_proj_type);
+  mix(h, ip.partition_gran);
+  mix(h, ip.num_tier_row_sprd);
+  mix(h, ip.num_tier_col_sprd);
+  mix(h, ip.fine_gran_bank_lvl);
+  mix(h, ip.ic_proj_type);
+  mix(h, ip.wire_is_mat_type);
+  mix(h, ip.wire_os_mat_type);
+  mix(h, ip.wt);
+  mix(h, ip.force_wiretype);
+  mix(h, ip.ndbl);
+  mix(h, ip.ndwl);
+  mix(h, ip.nspd);
+  mix(h, ip.ndsam1);
+  mix(h, ip.ndsam2);
+  mix(h, ip.ndcm);
+  mix(h, ip.force_cache_config);
+  mix(h, ip.fast_access);
+  mix(h, ip.block_sz);
+  mix(h, ip.tag_assoc);
+  mix(h, ip.data_assoc);
+  mix(h, ip.is_seq_acc);
+  mix(h, ip.fully_assoc);
+  mix(h, ip.nsets);
+  mix(h, ip.add_ecc_b_);
+  mix(h, ip.throughput);
+  mix(h, ip.latency);
+  mix(h, ip.pipelinable);
+  mix(h, ip.pipeline_stages);
+  mix(h, ip.per_stage_vector);
+  mix(h, ip.with_clock_grid);
+  mix(h, ip.array_power_gated);
+  mix(h, ip.bitline_floating);
+  mix(h, ip.wl_power_gated);
+  mix(h, ip.cl_power_gated);
+  mix(h, ip.interconect_power_gated);
+  mix(h, ip.power_gating);
+  mix(h, ip.perfloss);
+  mix(h, ip.cl_vertical);
+
+  int    tech_lo, tech_hi;
+  string in_file_lo, in_file_hi;
+  g_tp.find_upper_and_lower_tech(ip.F_sz_um * 1000.0, tech_lo, in_file_lo, tech_hi, in_file_hi);
+  mix(h, TechDataFile::get(in_file_lo).checksum);
+  mix(h, TechDataFile::get(in_file_hi).checksum);
+
+  return h;
+}
+
+
+
+static uint64_t sweep_key(const calc_time_mt_wrapper_struct & sweep)
+{
+  uint64_t h = PartitionMemo::input_key(*g_ip);
+
+  mix(h, sweep.is_tag);
+  mix(h, sweep.pure_ram);
+  mix(h, sweep.pure_cam);
+  mix(h, sweep.is_main_mem);
+  mix(h, sweep.prune);
+  mix(h, sweep.Nspd);
+  mix(h, sweep.wt);
+  mix(h, sweep.Ndwl);
+  mix(h, sweep.Ndbl);
+  mix(h, sweep.Ndcm);
+  mix(h, sweep.Ndsam_lev_1);
+  mix(h, sweep.Ndsam_lev_2);
+
+  return h;
+}
+
+
+
+PartitionMemo::PartitionMemo(uint64_t k)
+  : key(k)
+{
+  ostringstream name;
+  name << dir << "/" << hex;
+  name.width(16);
+  name.fill('0');
+  name << key << ".memo";
+  file_name = name.str();
+}
+
+PartitionMemo * PartitionMemo::open(const calc_time_mt_wrapper_struct & sweep)
+{
+  if (dir.empty())
+  {
+    return NULL;
+  }
+  return new PartitionMemo(sweep_key(sweep));
+}
+
+
+// File layout: magic, version, sizeof(mem_array), key and record count,
+// then per valid partition its candidate index, the length of its packed
+// mem_array (mem_array::pack) in words and those words. A file that does
+// not match this build is ignored and replaced by the next sweep.
+bool PartitionMemo::load(calc_time_mt_wrapper_struct & sweep)
+{
+  FILE * fp = fopen(file_name.c_str(), "rb");
+  if (fp == NULL)
+  {
+    return false;
+  }
+
+  char     magic[8];
+  uint32_t version, rec_size;
+  uint64_t file_key, count;
+  bool ok = fread(magic, sizeof(magic), 1, fp) == 1 &&
+            fread(&version, sizeof(version), 1, fp) == 1 &&
+            fread(&rec_size, sizeof(rec_size), 1, fp) == 1 &&
+            fread(&file_key, sizeof(file_key), 1, fp) == 1 &&
+            fread(&count, sizeof(count), 1, fp) == 1 &&
+            memcmp(magic, memo_magic, sizeof(magic)) == 0 &&
+            version == MEMO_VERSION &&
+            rec_size == sizeof(mem_array) &&
+            file_key == key;
+
+  sweep.slot.clear();
+  sweep.slot.resize(1);
+  calc_time_slot & res = sweep.slot[0];
+  if (ok)
+  {
+    res.rank.reserve(count);
+  }
+
+  mem_array tmp;
+  for (uint64_t i = 0; ok && i < count; i++)
+  {
+    uint64_t idx, pos = res.packed.size();
+    uint32_t n;
+    ok = fread(&idx, sizeof(idx), 1, fp) == 1 &&
+         fread(&n, sizeof(n), 1, fp) == 1 &&
+         n <= MEMO_MAX_WORDS;
+    if (ok)
+    {
+      res.packed.resize(pos + n);
+      ok = fread(&res.packed[pos], sizeof(uint64_t), n, fp) == n &&
+           mem_array::packed_size(&res.packed[pos]) == n;
+    }
+    if (ok)
+    {
+      mem_array::unpack(&res.packed[pos], tmp);
+      res.rank.push_back(mem_array_rank(idx, pos, tmp));
+      res.min_res.update_min_values(&tmp);
+    }
+  }
+  fclose(fp);
+
+  if (!ok)
+  {
+    cerr << "Ignoring damaged memo file " << file_name << endl;
+    sweep.slot.clear();
+  }
+  return ok;
+}
+
+void PartitionMemo::save(const vector<mem_array_rank> & arr)
+{
+  // write to a private file first so concurrent runs never see half a memo
+  ostringstream tmp_name;
+  tmp_name << file_name << "." << getpid() << "." << (uintptr_t) this;
+  FILE * fp = fopen(tmp_name.str().c_str(), "wb");
+  if (fp == NULL)
+  {
+    cerr << "Memo file " << tmp_name.str() << " could not be opened successfully" << endl;
+    return;
+  }
+
+  uint32_t version  = MEMO_VERSION;
+  uint32_t rec_size = sizeof(mem_array);
+  uint64_t count    = arr.size();
+  bool ok = fwrite(memo_magic, sizeof(memo_magic), 1, fp) == 1 &&
+            fwrite(&version, sizeof(version), 1, fp) == 1 &&
+            fwrite(&rec_size, sizeof(rec_size), 1, fp) == 1 &&
+            fwrite(&key, sizeof(key), 1, fp) == 1 &&
+            fwrite(&count, sizeof(count), 1, fp) == 1;
+
+  for (uint32_t i = 0; ok && i < arr.size(); i++)
+  {
+    uint32_t n = mem_array::packed_size(arr[i].detail);
+    ok = fwrite(&arr[i].idx, sizeof(arr[i].idx), 1, fp) == 1 &&
+         fwrite(&n, sizeof(n), 1, fp) == 1 &&
+         fwrite(arr[i].detail, sizeof(uint64_t), n, fp) == n;
+  }
+  ok = (fclose(fp) == 0) && ok;
+
+  if (!ok || rename(tmp_name.str().c_str(), file_name.c_str()) != 0)
+  {
+    cerr << "Memo file " << file_name << " could not be written" << endl;
+    remove(tmp_name.str().c_str());
+  }
+}
@@ -0,0 +1,83 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#ifndef __PARTITION_MEMO_H__
+#define __PARTITION_MEMO_H__
+
+#include <string>
+#include <vector>
+#include "cacti_interface.h"
+
+using namespace std;
+
+struct calc_time_mt_wrapper_struct;
+struct mem_array_rank;
+
+
+// On-disk memo of partition sweeps. A memo file holds the valid partitions
+// of one sweep, keyed by a hash of the candidate space, the InputParameter
+// fields calculate_time() depends on and the contents of the tech files in
+// use. Objective weights and deviation limits are only applied after the
+// sweep, so reruns that change them read every sweep back from the memo.
+//
+// The memo is off unless a directory is given with set_dir(), which creates
+// it if needed.
+class PartitionMemo
+{
+  public:
+    static void set_dir(const string & dir);
+
+    // memo of the sweep for the current g_ip and technology, or NULL if
+    // the memo is off
+    static PartitionMemo * open(const calc_time_mt_wrapper_struct & sweep);
+
+    // hash of the inputs a sweep depends on, leaving out the objective
+    // weights and deviation limits
+    static uint64_t input_key(const InputParameter & ip);
+
+    // read every valid partition into a single slot of the sweep; false if
+    // the sweep is not in the memo
+    bool load(calc_time_mt_wrapper_struct & sweep);
+    void save(const vector<mem_array_rank> & arr);
+
+  private:
+    uint64_t key;
+    string   file_name;
+
+    static string dir;
+
+    PartitionMemo(uint64_t key);
+};
+
+#endif
@@ -0,0 +1,269 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#include <pthread.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+#include "profile.h"
+#include "thread_pool.h"
+
+using namespace std;
+
+
+#define PROFILE_MAX_DEPTH 16
+
+bool   Profiler::on = false;
+string Profiler::file;
+
+static const char * phase_name[NUM_PROFILE_PHASES] = {
+  "tech_init", "wire_init", "tsv_extio", "tag_sweep", "data_sweep",
+  "combine", "nuca", "memcad", "output"
+};
+
+struct profile_time
+{
+  uint64_t calls;
+  double   wall;
+  double   cpu;
+
+  profile_time() : calls(0), wall(0), cpu(0) { }
+};
+
+static pthread_mutex_t profile_lock = PTHREAD_MUTEX_INITIALIZER;
+static double start_wall;
+static vector<vector<profile_time> > thread_time;  // [thread][phase]
+static profile_time phase_time[NUM_PROFILE_PHASES];
+static uint64_t counter[NUM_PROFILE_COUNTERS];
+
+// per thread: row in thread_time and the stack of open phases
+static __thread int  prof_thread = -1;
+static __thread int  depth = 0;
+static __thread int  stack_phase[PROFILE_MAX_DEPTH];
+static __thread bool stack_pool_job[PROFILE_MAX_DEPTH];
+static __thread double stack_wall[PROFILE_MAX_DEPTH];
+static __thread double stack_cpu[PROFILE_MAX_DEPTH];
+
+
+static double clock_seconds(clockid_t id)
+{
+  struct timespec ts;
+  clock_gettime(id, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+
+// Charge the time since the top of the stack was entered or resumed to its
+// phase. Called with profile_lock held.
+static void charge_top(double wall, double cpu)
+{
+  int p = stack_phase[depth - 1];
+  profile_time & t = thread_time[prof_thread][p];
+
+  t.wall += wall - stack_wall[depth - 1];
+  t.cpu  += cpu - stack_cpu[depth - 1];
+  phase_time[p].cpu += cpu - stack_cpu[depth - 1];
+  if (!stack_pool_job[depth - 1])
+  {
+    phase_time[p].wall += wall - stack_wall[depth - 1];
+  }
+}
+
+
+
+void Profiler::enable(const string & file_name)
+{
+  pthread_mutex_lock(&profile_lock);
+  if (!on)
+  {
+    on = true;
+    file = file_name;
+    atexit(write);
+    start_wall = clock_seconds(CLOCK_MONOTONIC);
+    prof_thread = 0;
+    thread_time.push_back(vector<profile_time>(NUM_PROFILE_PHASES));
+  }
+  pthread_mutex_unlock(&profile_lock);
+}
+
+
+
+void Profiler::count(profile_counter c, uint64_t n)
+{
+  if (!on) return;
+  pthread_mutex_lock(&profile_lock);
+  counter[c] += n;
+  pthread_mutex_unlock(&profile_lock);
+}
+
+
+
+int Profiler::current_phase()
+{
+  return (on && depth > 0) ? stack_phase[depth - 1] : -1;
+}
+
+
+
+ProfilePhase::ProfilePhase(int phase, bool pool_job)
+ :active(Profiler::enabled() && phase >= 0 && depth < PROFILE_MAX_DEPTH)
+{
+  if (!active) return;
+
+  double wall = clock_seconds(CLOCK_MONOTONIC);
+  double cpu  = clock_seconds(CLOCK_THREAD_CPUTIME_ID);
+
+  pthread_mutex_lock(&profile_lock);
+  if (prof_thread < 0)
+  {
+    prof_thread = thread_time.size();
+    thread_time.push_back(vector<profile_time>(NUM_PROFILE_PHASES));
+  }
+  if (depth > 0)
+  {
+    charge_top(wall, cpu);
+  }
+  thread_time[prof_thread][phase].calls++;
+  if (!pool_job)
+  {
+    phase_time[phase].calls++;
+  }
+  pthread_mutex_unlock(&profile_lock);
+
+  stack_phase[depth]    = phase;
+  stack_pool_job[depth] = pool_job;
+  stack_wall[depth]     = wall;
+  stack_cpu[depth]      = cpu;
+  depth++;
+}
+
+
+
+ProfilePhase::~ProfilePhase()
+{
+  if (!active) return;
+
+  double wall = clock_seconds(CLOCK_MONOTONIC);
+  double cpu  = clock_seconds(CLOCK_THREAD_CPUTIME_ID);
+
+  pthread_mutex_lock(&profile_lock);
+  charge_top(wall, cpu);
+  pthread_mutex_unlock(&profile_lock);
+
+  depth--;
+  if (depth > 0)
+  {
+    // the outer phase resumes
+    stack_wall[depth - 1] = wall;
+    stack_cpu[depth - 1]  = cpu;
+  }
+}
+
+
+
+static void write_time(ofstream & out, const profile_time & t)
+{
+  out << "{\"calls\": " << t.calls << ", \"wall_s\": " << t.wall
+      << ", \"cpu_s\": " << t.cpu << "}";
+}
+
+
+
+void Profiler::write()
+{
+  ofstream out(file.c_str());
+  if (!out)
+  {
+    cerr << "Unable to open " << file << endl;
+    return;
+  }
+
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  double wall = clock_seconds(CLOCK_MONOTONIC) - start_wall;
+  double cpu  = ru.ru_utime.tv_sec + ru.ru_utime.tv_usec * 1e-6 +
+                ru.ru_stime.tv_sec + ru.ru_stime.tv_usec * 1e-6;
+
+  pthread_mutex_lock(&profile_lock);
+  out.precision(6);
+  out << "{\n";
+  out << "  \"threads\": " << ThreadPool::instance().num_slots() << ",\n";
+  out << "  \"wall_s\": " << wall << ",\n";
+  out << "  \"cpu_s\": " << cpu << ",\n";
+  out << "  \"peak_rss_kb\": " << ru.ru_maxrss << ",\n";
+
+  out << "  \"phases\": {\n";
+  for (int p = 0; p < NUM_PROFILE_PHASES; p++)
+  {
+    out << "    \"" << phase_name[p] << "\": ";
+    write_time(out, phase_time[p]);
+    out << ((p + 1 < NUM_PROFILE_PHASES) ? ",\n" : "\n");
+  }
+  out << "  },\n";
+
+  out << "  \"thread_phases\": [\n";
+  for (uint32_t t = 0; t < thread_time.size(); t++)
+  {
+    out << "    {\"thread\": " << t;
+    for (int p = 0; p < NUM_PROFILE_PHASES; p++)
+    {
+      if (thread_time[t][p].calls > 0)
+      {
+        out << ", \"" << phase_name[p] << "\": ";
+        write_time(out, thread_time[t][p]);
+      }
+    }
+    out << "}" << ((t + 1 < thread_time.size()) ? ",\n" : "\n");
+  }
+  out << "  ],\n";
+
+  out << "  \"candidates\": {\n";
+  out << "    \"tag\": {\"enumerated\": " << counter[PROF_TAG_ENUMERATED]
+      << ", \"evaluated\": " << counter[PROF_TAG_EVALUATED]
+      << ", \"valid\": " << counter[PROF_TAG_VALID]
+      << ", \"filtered\": " << counter[PROF_TAG_FILTERED] << "},\n";
+  out << "    \"data\": {\"enumerated\": " << counter[PROF_DATA_ENUMERATED]
+      << ", \"evaluated\": " << counter[PROF_DATA_EVALUATED]
+      << ", \"valid\": " << counter[PROF_DATA_VALID]
+      << ", \"filtered\": " << counter[PROF_DATA_FILTERED] << "},\n";
+  out << "    \"combined\": " << counter[PROF_ORGS_COMBINED] << "\n";
+  out << "  }\n";
+  out << "}\n";
+  pthread_mutex_unlock(&profile_lock);
+}
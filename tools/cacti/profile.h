@@ -0,0 +1,109 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+#include <stdint.h>
+#include <string>
+
+using namespace std;
+
+
+enum profile_phase
+{
+  PROF_TECH_INIT,
+  PROF_WIRE_INIT,
+  PROF_TSV_EXTIO,
+  PROF_TAG_SWEEP,
+  PROF_DATA_SWEEP,
+  PROF_COMBINE,
+  PROF_NUCA,
+  PROF_MEMCAD,
+  PROF_OUTPUT,
+  NUM_PROFILE_PHASES
+};
+
+enum profile_counter
+{
+  PROF_TAG_ENUMERATED,  // candidates of the sweeps run, see partition_sweep_size()
+  PROF_TAG_EVALUATED,   // candidates that passed the validity checks and built their arrays
+  PROF_TAG_VALID,       // partitions the sweep kept, evaluated or memoized
+  PROF_TAG_FILTERED,    // valid partitions filter_tag_arr() dropped
+  PROF_DATA_ENUMERATED,
+  PROF_DATA_EVALUATED,
+  PROF_DATA_VALID,
+  PROF_DATA_FILTERED,
+  PROF_ORGS_COMBINED,   // tag and data pairs ranked by find_optimal_uca()
+  NUM_PROFILE_COUNTERS
+};
+
+
+// Run profile for -profile. Phases are timed with ProfilePhase scopes; a
+// phase entered inside another one is not counted in the outer one. Work
+// that pool threads do for a parallel_for() is charged to the phase of
+// the thread that called it, on the pool thread's own row.
+class Profiler
+{
+  public:
+    // starts the profile; it is written to file_name as JSON when the
+    // program exits, also if it exits on an error
+    static void enable(const string & file_name);
+    static bool enabled() { return on; }
+
+    static void count(profile_counter c, uint64_t n);
+    // phase of the calling thread, -1 outside of phases
+    static int  current_phase();
+
+  private:
+    static void write();
+
+    static bool   on;
+    static string file;
+};
+
+
+class ProfilePhase
+{
+  public:
+    // pool_job: work done for another thread's phase; it shows in the
+    // thread's row but not in the phase's calls and wall time
+    ProfilePhase(int phase, bool pool_job = false);
+    ~ProfilePhase();
+
+  private:
+    bool active;
+};
+
+#endif
@@ -0,0 +1,639 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+// Python 3 module "cacti" (make python). It exposes
+//   InputParameter(cfg_file=None, lines=None)  a config, plus set(*lines)
+//   uca_org_t                                  metrics of a solved config
+//   solve(ip)          -> uca_org_t
+//   solve_many(ips)    -> dict of array.array columns, one entry per config
+//   set_threads(n)     size of the thread pool, before the first solve
+// Solves run without the GIL. solve() spreads the partition sweep over the
+// thread pool, solve_many() solves a config per pool thread at a time.
+// Times are in s, energies in J, power in W and areas in um^2, as in
+// uca_org_t. Tech files are read relative to the working directory.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <structmember.h>
+
+#include "cacti_interface.h"
+#include "parameter.h"
+#include "sweep.h"
+#include "thread_pool.h"
+
+#include <pthread.h>
+#include <stddef.h>
+#include <cstdio>
+#include <new>
+#include <vector>
+
+using namespace std;
+
+
+// what is kept of a solved uca_org_t
+struct uca_summary
+{
+  char   valid;
+  double access_time;
+  double cycle_time;
+  double search_energy;  // 0 unless fully associative or a CAM
+  double read_energy;
+  double write_energy;
+  double leakage;
+  double gate_leakage;
+  double area;
+  double area_efficiency;  // of the data array, in %
+  int    Ndwl, Ndbl;
+  double Nspd;
+  int    Ndcm, Ndsam_lev_1, Ndsam_lev_2;
+  int    Ntwl, Ntbl;       // tag array, 0 without one
+  double Ntspd;
+  int    Ntcm, Ntsam_lev_1, Ntsam_lev_2;
+  const char * error;    // why valid is 0
+};
+
+struct uca_column
+{
+  const char * name;
+  size_t       offset;
+  char         type;  // array.array typecode
+};
+
+#define UCA_COLUMN(f, t) { #f, offsetof(uca_summary, f), t }
+
+static const uca_column uca_columns[] = {
+  UCA_COLUMN(valid, 'b'),
+  UCA_COLUMN(access_time, 'd'),
+  UCA_COLUMN(cycle_time, 'd'),
+  UCA_COLUMN(search_energy, 'd'),
+  UCA_COLUMN(read_energy, 'd'),
+  UCA_COLUMN(write_energy, 'd'),
+  UCA_COLUMN(leakage, 'd'),
+  UCA_COLUMN(gate_leakage, 'd'),
+  UCA_COLUMN(area, 'd'),
+  UCA_COLUMN(area_efficiency, 'd'),
+  UCA_COLUMN(Ndwl, 'i'),
+  UCA_COLUMN(Ndbl, 'i'),
+  UCA_COLUMN(Nspd, 'd'),
+  UCA_COLUMN(Ndcm, 'i'),
+  UCA_COLUMN(Ndsam_lev_1, 'i'),
+  UCA_COLUMN(Ndsam_lev_2, 'i'),
+  UCA_COLUMN(Ntwl, 'i'),
+  UCA_COLUMN(Ntbl, 'i'),
+  UCA_COLUMN(Ntspd, 'd'),
+  UCA_COLUMN(Ntcm, 'i'),
+  UCA_COLUMN(Ntsam_lev_1, 'i'),
+  UCA_COLUMN(Ntsam_lev_2, 'i'),
+};
+#define NUM_UCA_COLUMNS (sizeof(uca_columns) / sizeof(uca_columns[0]))
+
+
+static void summarize(const InputParameter & ip, const uca_org_t & fin_res, uca_summary & s)
+{
+  s.valid           = 1;
+  s.access_time     = fin_res.access_time;
+  s.cycle_time      = fin_res.cycle_time;
+  s.search_energy   = (ip.fully_assoc || ip.pure_cam) ? fin_res.power.searchOp.dynamic : 0;
+  s.read_energy     = fin_res.power.readOp.dynamic;
+  s.write_energy    = fin_res.power.writeOp.dynamic;
+  s.leakage         = fin_res.power.readOp.leakage;
+  s.gate_leakage    = fin_res.power.readOp.gate_leakage;
+  s.area            = fin_res.area;
+  s.area_efficiency = fin_res.data_array2->area_efficiency;
+
+  const mem_array * d = fin_res.data_array2;
+  s.Ndwl        = d->Ndwl;
+  s.Ndbl        = d->Ndbl;
+  s.Nspd        = d->Nspd;
+  s.Ndcm        = d->deg_bl_muxing;
+  s.Ndsam_lev_1 = d->Ndsam_lev_1;
+  s.Ndsam_lev_2 = d->Ndsam_lev_2;
+  if (!(ip.fully_assoc || ip.pure_cam || ip.pure_ram))
+  {
+    const mem_array * t = fin_res.tag_array2;
+    s.Ntwl        = t->Ndwl;
+    s.Ntbl        = t->Ndbl;
+    s.Ntspd       = t->Nspd;
+    s.Ntcm        = t->deg_bl_muxing;
+    s.Ntsam_lev_1 = t->Ndsam_lev_1;
+    s.Ntsam_lev_2 = t->Ndsam_lev_2;
+  }
+}
+
+
+
+// Solver contexts of the module, one per pool slot, so wire models stay
+// built from one call to the next. Calls from several Python threads take
+// turns on them.
+static pthread_mutex_t solve_lock = PTHREAD_MUTEX_INITIALIZER;
+static vector<sweep_slot *> solve_slots;
+
+static void solve_one(sweep_slot & s, InputParameter & ip, uca_summary & res)
+{
+  uca_org_t fin_res;
+
+  memset(&res, 0, sizeof(res));
+  res.error = solve_on_slot(s, ip, fin_res);
+  if (res.error == NULL)
+  {
+    summarize(ip, fin_res, res);
+    fin_res.cleanup();
+  }
+}
+
+struct solve_many_struct
+{
+  vector<InputParameter> * ips;
+  vector<uca_summary>    * res;
+};
+
+static void solve_many_mt(void * void_obj, uint64_t idx, uint32_t slot)
+{
+  solve_many_struct * obj = (solve_many_struct *) void_obj;
+  solve_one(*solve_slots[slot], (*obj->ips)[idx], (*obj->res)[idx]);
+}
+
+// Solves every config; with more than one, each pool thread takes whole
+// configs. Called without the GIL.
+static void solve_all(vector<InputParameter> & ips, vector<uca_summary> & res)
+{
+  ThreadPool & pool = ThreadPool::instance();
+
+  pthread_mutex_lock(&solve_lock);
+  while (solve_slots.size() < pool.num_slots())
+  {
+    solve_slots.push_back(new sweep_slot());
+  }
+  res.resize(ips.size());
+  if (ips.size() == 1)
+  {
+    solve_one(*solve_slots[0], ips[0], res[0]);
+  }
+  else
+  {
+    solve_many_struct obj;
+    obj.ips = &ips;
+    obj.res = &res;
+    pool.parallel_for(ips.size(), solve_many_mt, (void *) &obj);
+  }
+  pthread_mutex_unlock(&solve_lock);
+}
+
+
+
+struct PyInputParameter
+{
+  PyObject_HEAD
+  InputParameter ip;
+};
+
+static PyTypeObject PyInputParameter_Type;
+
+#define IP_MEMBER(f, t) { (char *) #f, t, offsetof(PyInputParameter, ip) + offsetof(InputParameter, f), 0, NULL }
+
+static PyMemberDef PyInputParameter_members[] = {
+  IP_MEMBER(cache_sz, T_UINT),
+  IP_MEMBER(line_sz, T_UINT),
+  IP_MEMBER(assoc, T_UINT),
+  IP_MEMBER(nbanks, T_UINT),
+  IP_MEMBER(out_w, T_UINT),
+  IP_MEMBER(specific_tag, T_BOOL),
+  IP_MEMBER(tag_w, T_UINT),
+  IP_MEMBER(access_mode, T_UINT),
+  IP_MEMBER(num_rw_ports, T_UINT),
+  IP_MEMBER(num_rd_ports, T_UINT),
+  IP_MEMBER(num_wr_ports, T_UINT),
+  IP_MEMBER(num_se_rd_ports, T_UINT),
+  IP_MEMBER(num_search_ports, T_UINT),
+  IP_MEMBER(temp, T_UINT),
+  IP_MEMBER(data_arr_ram_cell_tech_type, T_UINT),
+  IP_MEMBER(data_arr_peri_global_tech_type, T_UINT),
+  IP_MEMBER(tag_arr_ram_cell_tech_type, T_UINT),
+  IP_MEMBER(tag_arr_peri_global_tech_type, T_UINT),
+  IP_MEMBER(delay_wt, T_INT),
+  IP_MEMBER(dynamic_power_wt, T_INT),
+  IP_MEMBER(leakage_power_wt, T_INT),
+  IP_MEMBER(cycle_time_wt, T_INT),
+  IP_MEMBER(area_wt, T_INT),
+  IP_MEMBER(delay_dev, T_INT),
+  IP_MEMBER(dynamic_power_dev, T_INT),
+  IP_MEMBER(leakage_power_dev, T_INT),
+  IP_MEMBER(cycle_time_dev, T_INT),
+  IP_MEMBER(area_dev, T_INT),
+  IP_MEMBER(ed, T_INT),
+  { NULL, 0, 0, 0, NULL }
+};
+
+static PyObject * PyInputParameter_new(PyTypeObject * type, PyObject *, PyObject *)
+{
+  PyInputParameter * self = (PyInputParameter *) type->tp_alloc(type, 0);
+  if (self != NULL)
+  {
+    new (&self->ip) InputParameter();
+  }
+  return (PyObject *) self;
+}
+
+static void PyInputParameter_dealloc(PyInputParameter * self)
+{
+  self->ip.~InputParameter();
+  Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+// Config lines from a str or a sequence of them; false with an exception set
+// if it is neither.
+static bool config_lines(PyObject * obj, vector<string> & lines)
+{
+  if (PyUnicode_Check(obj))
+  {
+    lines.push_back(PyUnicode_AsUTF8(obj));
+    return true;
+  }
+  PyObject * seq = PySequence_Fast(obj, "config lines have to be a str or a sequence of str");
+  if (seq == NULL)
+  {
+    return false;
+  }
+  for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(seq); i++)
+  {
+    PyObject * item = PySequence_Fast_GET_ITEM(seq, i);
+    const char * line = PyUnicode_Check(item) ? PyUnicode_AsUTF8(item) : NULL;
+    if (line == NULL)
+    {
+      Py_DECREF(seq);
+      PyErr_SetString(PyExc_TypeError, "config lines have to be str");
+      return false;
+    }
+    lines.push_back(line);
+  }
+  Py_DECREF(seq);
+  return true;
+}
+
+static int PyInputParameter_init(PyInputParameter * self, PyObject * args, PyObject * kwds)
+{
+  static const char * kwlist[] = { "cfg_file", "lines", NULL };
+  const char * cfg_file = NULL;
+  PyObject   * lines_obj = NULL;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "|zO", (char **) kwlist, &cfg_file, &lines_obj))
+  {
+    return -1;
+  }
+
+  vector<string> lines;
+  if (lines_obj != NULL && lines_obj != Py_None && !config_lines(lines_obj, lines))
+  {
+    return -1;
+  }
+
+  self->ip.~InputParameter();
+  new (&self->ip) InputParameter();
+  if (cfg_file != NULL)
+  {
+    // parse_cfg() exits on a missing file
+    FILE * fp = fopen(cfg_file, "r");
+    if (fp == NULL)
+    {
+      PyErr_SetFromErrnoWithFilename(PyExc_OSError, cfg_file);
+      return -1;
+    }
+    fclose(fp);
+    self->ip.parse_cfg(string(cfg_file));
+  }
+  self->ip.parse_cfg(lines);
+  return 0;
+}
+
+static PyObject * PyInputParameter_set(PyInputParameter * self, PyObject * args)
+{
+  vector<string> lines;
+  if (!config_lines(args, lines))
+  {
+    return NULL;
+  }
+  self->ip.parse_cfg(lines);
+  Py_RETURN_NONE;
+}
+
+static PyObject * PyInputParameter_copy(PyInputParameter * self, PyObject *)
+{
+  PyInputParameter * c = (PyInputParameter *) PyInputParameter_new(Py_TYPE(self), NULL, NULL);
+  if (c != NULL)
+  {
+    c->ip = self->ip;
+  }
+  return (PyObject *) c;
+}
+
+static PyObject * PyInputParameter_get_technology(PyInputParameter * self, void *)
+{
+  return PyFloat_FromDouble(self->ip.F_sz_um);
+}
+
+static int PyInputParameter_set_technology(PyInputParameter * self, PyObject * value, void *)
+{
+  double um = (value != NULL) ? PyFloat_AsDouble(value) : -1;
+  if (value == NULL || PyErr_Occurred())
+  {
+    if (!PyErr_Occurred()) PyErr_SetString(PyExc_TypeError, "technology cannot be deleted");
+    return -1;
+  }
+  self->ip.F_sz_um = um;
+  self->ip.F_sz_nm = um * 1000;
+  return 0;
+}
+
+static PyMethodDef PyInputParameter_methods[] = {
+  { "set", (PyCFunction) PyInputParameter_set, METH_VARARGS,
+    "set(*lines): apply config file lines, e.g. ip.set('-size (bytes) 65536')" },
+  { "copy", (PyCFunction) PyInputParameter_copy, METH_NOARGS, "copy of the config" },
+  { NULL, NULL, 0, NULL }
+};
+
+static PyGetSetDef PyInputParameter_getset[] = {
+  { (char *) "technology", (getter) PyInputParameter_get_technology,
+    (setter) PyInputParameter_set_technology, (char *) "feature size in um", NULL },
+  { NULL, NULL, NULL, NULL, NULL }
+};
+
+
+
+struct PyUcaOrg
+{
+  PyObject_HEAD
+  uca_summary res;
+};
+
+static PyTypeObject PyUcaOrg_Type;
+
+#define UCA_MEMBER(f, t) { (char *) #f, t, offsetof(PyUcaOrg, res) + offsetof(uca_summary, f), READONLY, NULL }
+
+static PyMemberDef PyUcaOrg_members[] = {
+  UCA_MEMBER(valid, T_BOOL),
+  UCA_MEMBER(access_time, T_DOUBLE),
+  UCA_MEMBER(cycle_time, T_DOUBLE),
+  UCA_MEMBER(search_energy, T_DOUBLE),
+  UCA_MEMBER(read_energy, T_DOUBLE),
+  UCA_MEMBER(write_energy, T_DOUBLE),
+  UCA_MEMBER(leakage, T_DOUBLE),
+  UCA_MEMBER(gate_leakage, T_DOUBLE),
+  UCA_MEMBER(area, T_DOUBLE),
+  UCA_MEMBER(area_efficiency, T_DOUBLE),
+  UCA_MEMBER(Ndwl, T_INT),
+  UCA_MEMBER(Ndbl, T_INT),
+  UCA_MEMBER(Nspd, T_DOUBLE),
+  UCA_MEMBER(Ndcm, T_INT),
+  UCA_MEMBER(Ndsam_lev_1, T_INT),
+  UCA_MEMBER(Ndsam_lev_2, T_INT),
+  UCA_MEMBER(Ntwl, T_INT),
+  UCA_MEMBER(Ntbl, T_INT),
+  UCA_MEMBER(Ntspd, T_DOUBLE),
+  UCA_MEMBER(Ntcm, T_INT),
+  UCA_MEMBER(Ntsam_lev_1, T_INT),
+  UCA_MEMBER(Ntsam_lev_2, T_INT),
+  { NULL, 0, 0, 0, NULL }
+};
+
+static PyObject * PyUcaOrg_get_error(PyUcaOrg * self, void *)
+{
+  if (self->res.error == NULL)
+  {
+    Py_RETURN_NONE;
+  }
+  return PyUnicode_FromString(self->res.error);
+}
+
+static PyGetSetDef PyUcaOrg_getset[] = {
+  { (char *) "error", (getter) PyUcaOrg_get_error, NULL,
+    (char *) "why no organization was found, None if valid", NULL },
+  { NULL, NULL, NULL, NULL, NULL }
+};
+
+static PyObject * PyUcaOrg_repr(PyUcaOrg * self)
+{
+  char buf[256];
+  if (!self->res.valid)
+  {
+    snprintf(buf, sizeof(buf), "<uca_org_t invalid: %s>", self->res.error);
+  }
+  else
+  {
+    snprintf(buf, sizeof(buf), "<uca_org_t access %.4g ns, cycle %.4g ns, read %.4g nJ, area %.4g mm2>",
+        self->res.access_time * 1e9, self->res.cycle_time * 1e9, self->res.read_energy * 1e9,
+        self->res.area * 1e-6);
+  }
+  return PyUnicode_FromString(buf);
+}
+
+
+
+// Copies of the configs in a sequence of InputParameter; false with an
+// exception set if it has anything else.
+static bool input_parameters(PyObject * obj, vector<InputParameter> & ips)
+{
+  PyObject * seq = PySequence_Fast(obj, "solve_many() takes a sequence of InputParameter");
+  if (seq == NULL)
+  {
+    return false;
+  }
+  ips.reserve(PySequence_Fast_GET_SIZE(seq));
+  for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(seq); i++)
+  {
+    PyObject * item = PySequence_Fast_GET_ITEM(seq, i);
+    if (!PyObject_TypeCheck(item, &PyInputParameter_Type))
+    {
+      Py_DECREF(seq);
+      PyErr_SetString(PyExc_TypeError, "solve_many() takes a sequence of InputParameter");
+      return false;
+    }
+    ips.push_back(((PyInputParameter *) item)->ip);
+  }
+  Py_DECREF(seq);
+  return true;
+}
+
+static PyObject * cacti_solve(PyObject *, PyObject * args)
+{
+  PyInputParameter * ip_obj;
+  if (!PyArg_ParseTuple(args, "O!", &PyInputParameter_Type, &ip_obj))
+  {
+    return NULL;
+  }
+
+  vector<InputParameter> ips(1, ip_obj->ip);
+  vector<uca_summary> res;
+  Py_BEGIN_ALLOW_THREADS
+  solve_all(ips, res);
+  Py_END_ALLOW_THREADS
+
+  PyUcaOrg * org = PyObject_New(PyUcaOrg, &PyUcaOrg_Type);
+  if (org != NULL)
+  {
+    org->res = res[0];
+  }
+  return (PyObject *) org;
+}
+
+static PyObject * cacti_solve_many(PyObject *, PyObject * args)
+{
+  PyObject * list;
+  if (!PyArg_ParseTuple(args, "O", &list))
+  {
+    return NULL;
+  }
+  vector<InputParameter> ips;
+  if (!input_parameters(list, ips))
+  {
+    return NULL;
+  }
+
+  vector<uca_summary> res;
+  Py_BEGIN_ALLOW_THREADS
+  solve_all(ips, res);
+  Py_END_ALLOW_THREADS
+
+  PyObject * array_mod = PyImport_ImportModule("array");
+  PyObject * array_type = (array_mod != NULL) ? PyObject_GetAttrString(array_mod, "array") : NULL;
+  Py_XDECREF(array_mod);
+  PyObject * out = (array_type != NULL) ? PyDict_New() : NULL;
+  if (out == NULL)
+  {
+    Py_XDECREF(array_type);
+    return NULL;
+  }
+
+  // one contiguous column per field, e.g. numpy.frombuffer(r['access_time'])
+  vector<char> buf;
+  for (unsigned int c = 0; c < NUM_UCA_COLUMNS; c++)
+  {
+    const uca_column & col = uca_columns[c];
+    size_t width = (col.type == 'd') ? sizeof(double) : (col.type == 'i') ? sizeof(int) : sizeof(char);
+    buf.resize(width * res.size() + 1);
+    for (size_t i = 0; i < res.size(); i++)
+    {
+      memcpy(&buf[i * width], (const char *) &res[i] + col.offset, width);
+    }
+    PyObject * column = PyObject_CallFunction(array_type, "Cy#", col.type, &buf[0],
+        (Py_ssize_t) (width * res.size()));
+    if (column == NULL || PyDict_SetItemString(out, col.name, column) != 0)
+    {
+      Py_XDECREF(column);
+      Py_DECREF(out);
+      Py_DECREF(array_type);
+      return NULL;
+    }
+    Py_DECREF(column);
+  }
+  Py_DECREF(array_type);
+
+  PyObject * errors = PyList_New(res.size());
+  for (size_t i = 0; errors != NULL && i < res.size(); i++)
+  {
+    PyObject * e = (res[i].error != NULL) ? PyUnicode_FromString(res[i].error) : Py_NewRef(Py_None);
+    PyList_SET_ITEM(errors, i, e);
+  }
+  if (errors == NULL || PyDict_SetItemString(out, "error", errors) != 0)
+  {
+    Py_XDECREF(errors);
+    Py_DECREF(out);
+    return NULL;
+  }
+  Py_DECREF(errors);
+  return out;
+}
+
+static PyObject * cacti_set_threads(PyObject *, PyObject * args)
+{
+  unsigned int n;
+  if (!PyArg_ParseTuple(args, "I", &n))
+  {
+    return NULL;
+  }
+  ThreadPool::set_size(n);
+  Py_RETURN_NONE;
+}
+
+static PyMethodDef cacti_methods[] = {
+  { "solve", cacti_solve, METH_VARARGS,
+    "solve(ip) -> uca_org_t; the partition sweep runs on the thread pool" },
+  { "solve_many", cacti_solve_many, METH_VARARGS,
+    "solve_many(ips) -> dict of array.array columns, one entry per config, and a list 'error'" },
+  { "set_threads", cacti_set_threads, METH_VARARGS,
+    "set_threads(n): size of the thread pool; only before the first solve" },
+  { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef cacti_module = {
+  PyModuleDef_HEAD_INIT, "cacti", "CACTI cache and memory model", -1, cacti_methods,
+  NULL, NULL, NULL, NULL
+};
+
+PyMODINIT_FUNC PyInit_cacti(void)
+{
+  PyInputParameter_Type.tp_name      = "cacti.InputParameter";
+  PyInputParameter_Type.tp_basicsize = sizeof(PyInputParameter);
+  PyInputParameter_Type.tp_flags     = Py_TPFLAGS_DEFAULT;
+  PyInputParameter_Type.tp_doc       = "InputParameter(cfg_file=None, lines=None): a cacti config";
+  PyInputParameter_Type.tp_new       = PyInputParameter_new;
+  PyInputParameter_Type.tp_init      = (initproc) PyInputParameter_init;
+  PyInputParameter_Type.tp_dealloc   = (destructor) PyInputParameter_dealloc;
+  PyInputParameter_Type.tp_members   = PyInputParameter_members;
+  PyInputParameter_Type.tp_methods   = PyInputParameter_methods;
+  PyInputParameter_Type.tp_getset    = PyInputParameter_getset;
+
+  PyUcaOrg_Type.tp_name      = "cacti.uca_org_t";
+  PyUcaOrg_Type.tp_basicsize = sizeof(PyUcaOrg);
+  PyUcaOrg_Type.tp_flags     = Py_TPFLAGS_DEFAULT;
+  PyUcaOrg_Type.tp_doc       = "metrics and partitions of a solved config";
+  PyUcaOrg_Type.tp_members   = PyUcaOrg_members;
+  PyUcaOrg_Type.tp_getset    = PyUcaOrg_getset;
+  PyUcaOrg_Type.tp_repr      = (reprfunc) PyUcaOrg_repr;
+
+  if (PyType_Ready(&PyInputParameter_Type) < 0 || PyType_Ready(&PyUcaOrg_Type) < 0)
+  {
+    return NULL;
+  }
+
+  PyObject * m = PyModule_Create(&cacti_module);
+  if (m == NULL)
+  {
+    return NULL;
+  }
+  Py_INCREF(&PyInputParameter_Type);
+  PyModule_AddObject(m, "InputParameter", (PyObject *) &PyInputParameter_Type);
+  Py_INCREF(&PyUcaOrg_Type);
+  PyModule_AddObject(m, "uca_org_t", (PyObject *) &PyUcaOrg_Type);
+  return m;
+}
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+#
+# Smoke test of the Python module (make python): solve() and solve_many()
+# on a few quick configs must give the access time, cycle time, energies,
+# leakage, area and partitions of test_configs/golden.csv, and an invalid
+# config must come back invalid instead of ending the process.
+#
+#   make python_test    or    ./python_test.py
+
+import csv
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+os.chdir(HERE)  # tech files are read relative to the working directory
+sys.path.insert(0, HERE)
+
+import cacti
+
+CONFIGS = ['cache1', 'cache4', 'ram4', 'cam1']
+RTOL = 1e-5  # golden.csv keeps 6 significant digits
+
+
+def metrics(get, i):
+    """Golden-style metrics of result i; get(name, i) reads one field."""
+    cache = get('Ntwl', i) != 0
+    org = [get(f, i) for f in ('Ndwl', 'Ndbl', 'Nspd', 'Ndcm', 'Ndsam_lev_1', 'Ndsam_lev_2')]
+    tag = [get(f, i) for f in ('Ntwl', 'Ntbl', 'Ntspd', 'Ntcm', 'Ntsam_lev_1', 'Ntsam_lev_2')]
+    search = get('search_energy', i)
+    return {
+        'access_time_ns': get('access_time', i) * 1e9,
+        'cycle_time_ns': get('cycle_time', i) * 1e9,
+        'search_energy_nJ': search * 1e9 if search else 'N/A',
+        'read_energy_nJ': get('read_energy', i) * 1e9,
+        'write_energy_nJ': get('write_energy', i) * 1e9,
+        'leakage_mW': (get('leakage', i) + get('gate_leakage', i)) * 1e3,
+        'area_mm2': get('area', i) * 1e-6,
+        'organization': ':'.join(['%g' % v for v in org] +
+                                 (['%g' % v for v in tag] if cache else ['N/A'] * 6)),
+    }
+
+
+def check(name, got, gold, area_efficiency):
+    """List of differences of got from its golden row."""
+    diffs = []
+    for m, v in got.items():
+        try:
+            a, b = float(v), float(gold[m])
+            same = abs(a - b) <= RTOL * max(abs(a), abs(b))
+        except ValueError:
+            same = (str(v) == gold[m])
+        if not same:
+            diffs.append('%s %s: %s != %s' % (name, m, v, gold[m]))
+    if not 0 < area_efficiency <= 100:
+        diffs.append('%s area_efficiency %s' % (name, area_efficiency))
+    return diffs
+
+
+def main():
+    with open(os.path.join(HERE, 'test_configs', 'golden.csv')) as f:
+        golden = dict((r['config'], r) for r in csv.DictReader(f))
+    ips = [cacti.InputParameter('test_configs/%s.cfg' % c) for c in CONFIGS]
+    diffs = []
+
+    for name, ip in zip(CONFIGS, ips):
+        r = cacti.solve(ip)
+        if not r.valid:
+            diffs.append('%s solve(): %s' % (name, r.error))
+            continue
+        diffs += check(name + ' solve()', metrics(lambda f, i: getattr(r, f), 0),
+                       golden[name], r.area_efficiency)
+
+    bad = ips[0].copy()
+    bad.cache_sz = 3
+    cols = cacti.solve_many(ips + [bad])
+    for i, name in enumerate(CONFIGS):
+        if not cols['valid'][i]:
+            diffs.append('%s solve_many(): %s' % (name, cols['error'][i]))
+            continue
+        diffs += check(name + ' solve_many()', metrics(lambda f, j: cols[f][j], i),
+                       golden[name], cols['area_efficiency'][i])
+    if cols['valid'][-1] or cols['error'][-1] is None:
+        diffs.append('invalid config reported valid')
+
+    for d in diffs:
+        print(d)
+    print('%s, %d configs' % ('FAIL' if diffs else 'ok', len(CONFIGS)))
+    return 1 if diffs else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
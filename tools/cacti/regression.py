@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+# Golden-output regression and benchmark for the configs in regression.test.
+#
+# Every config is solved with -profile in a scratch directory. The access
+# time, cycle time, energies, leakage, area and the chosen data and tag
+# array partitions from its .out csv row are compared to
+# test_configs/golden.csv, and so is the SHA-1 of the whole report cacti
+# prints. Run time, threads and candidates per second come from the
+# profile and can be appended to a csv with --bench.
+#
+#   ./regression.py                     check against the golden values
+#   ./regression.py -j 4 --bench b.csv  same on 4 threads, keep timings
+#   ./regression.py --prune             same with -prune, which must not
+#                                       change any result
+#   ./regression.py --update            rewrite the golden values
+#   ./regression.py cache1 ram2         only these configs
+
+import argparse
+import csv
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+GOLDEN = os.path.join(HERE, 'test_configs', 'golden.csv')
+
+# metric name -> .out csv column
+METRICS = [
+    ('access_time_ns', 'Access time (ns)'),
+    ('cycle_time_ns', 'Random cycle time (ns)'),
+    ('search_energy_nJ', 'Dynamic search energy (nJ)'),
+    ('read_energy_nJ', 'Dynamic read energy (nJ)'),
+    ('write_energy_nJ', 'Dynamic write energy (nJ)'),
+    ('leakage_mW', 'Standby leakage per bank(mW)'),
+    ('area_mm2', 'Area (mm2)'),
+]
+ORG = ['Ndwl', 'Ndbl', 'Nspd', 'Ndcm', 'Ndsam_level_1', 'Ndsam_level_2',
+       'Ntwl', 'Ntbl', 'Ntspd', 'Ntcm', 'Ntsam_level_1', 'Ntsam_level_2']
+FIELDS = ['config'] + [m for m, _ in METRICS] + ['organization', 'report_sha1']
+
+
+def configs():
+    """Config names in the order regression.test lists them."""
+    names = []
+    with open(os.path.join(HERE, 'regression.test')) as f:
+        for line in f:
+            m = re.search(r'-infile\s+test_configs/(\S+)\.cfg', line)
+            if m and m.group(1) not in names:
+                names.append(m.group(1))
+    return names
+
+
+def run(name, threads, binary, prune=False):
+    """Solve one config; returns (result row, benchmark row) or raises."""
+    scratch = tempfile.mkdtemp(prefix='cacti_regression_')
+    try:
+        cfg = os.path.join(scratch, name + '.cfg')
+        shutil.copy(os.path.join(HERE, 'test_configs', name + '.cfg'), cfg)
+        cmd = [binary, '-infile', cfg, '-threads', str(threads), '-profile']
+        if prune:
+            cmd.append('-prune')
+        start = time.time()
+        proc = subprocess.run(cmd, cwd=HERE, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        wall = time.time() - start
+        if proc.returncode != 0:
+            raise RuntimeError('cacti exited with %d' % proc.returncode)
+
+        with open(cfg + '.out') as f:
+            rows = [[c.strip() for c in r] for r in csv.reader(f)]
+        out = dict(zip(rows[0], rows[1]))
+        res = {'config': name}
+        for m, col in METRICS:
+            res[m] = out[col]
+        res['organization'] = ':'.join(out[c] for c in ORG)
+        # the report names the input file; hash it as if run in place
+        report = proc.stdout.replace(cfg.encode(), ('test_configs/%s.cfg' % name).encode())
+        res['report_sha1'] = hashlib.sha1(report).hexdigest()
+
+        with open(cfg + '.profile.json') as f:
+            prof = json.load(f)
+        cand = prof['candidates']
+        evaluated = cand['tag']['evaluated'] + cand['data']['evaluated']
+        bench = {'config': name, 'threads': prof['threads'], 'wall_s': '%.3f' % wall,
+                 'cpu_s': '%.3f' % prof['cpu_s'], 'candidates': evaluated,
+                 'candidates_per_s': '%.0f' % (evaluated / wall if wall > 0 else 0),
+                 'peak_rss_kb': prof['peak_rss_kb']}
+        return res, bench
+    finally:
+        shutil.rmtree(scratch)
+
+
+def compare(res, gold, rtol, exact):
+    """List of differences of res from its golden row."""
+    diffs = []
+    for m, _ in METRICS:
+        try:
+            a, b = float(res[m]), float(gold[m])
+            same = abs(a - b) <= rtol * max(abs(a), abs(b))
+        except ValueError:
+            same = (res[m] == gold[m])  # N/A
+        if not same:
+            diffs.append('%s %s != %s' % (m, res[m], gold[m]))
+    if res['organization'] != gold['organization']:
+        diffs.append('organization %s != %s' % (res['organization'], gold['organization']))
+    if exact and res['report_sha1'] != gold['report_sha1']:
+        diffs.append('report differs')
+    return diffs
+
+
+def main():
+    ap = argparse.ArgumentParser(description='cacti golden-output regression and benchmark')
+    ap.add_argument('config', nargs='*', help='configs to run (default: all of regression.test)')
+    ap.add_argument('-j', '--threads', type=int, default=1, help='solver threads')
+    ap.add_argument('--rtol', type=float, default=1e-6, help='relative tolerance of the metrics')
+    ap.add_argument('--no-exact', action='store_true', help='do not require identical reports')
+    ap.add_argument('--bench', help='append the timings to this csv')
+    ap.add_argument('--prune', action='store_true', help='solve with -prune')
+    ap.add_argument('--update', action='store_true', help='rewrite the golden values')
+    ap.add_argument('--cacti', default=os.path.join(HERE, 'cacti'), help='binary to test')
+    args = ap.parse_args()
+    if args.prune and args.update:
+        ap.error('the golden values come from the full search, not from --prune')
+
+    names = args.config or configs()
+    golden = {}
+    if os.path.exists(GOLDEN):
+        with open(GOLDEN) as f:
+            golden = dict((r['config'], r) for r in csv.DictReader(f))
+
+    failed = 0
+    benches = []
+    for name in names:
+        try:
+            res, bench = run(name, args.threads, args.cacti, args.prune)
+        except Exception as e:
+            print('%-12s FAIL  %s' % (name, e))
+            failed += 1
+            continue
+        benches.append(bench)
+        timing = '%8ss %10s cand/s' % (bench['wall_s'], bench['candidates_per_s'])
+        if args.update:
+            golden[name] = res
+            print('%-12s saved %s' % (name, timing))
+        elif name not in golden:
+            print('%-12s FAIL  no golden values %s' % (name, timing))
+            failed += 1
+        else:
+            diffs = compare(res, golden[name], args.rtol, not args.no_exact)
+            print('%-12s %s %s' % (name, 'FAIL ' if diffs else 'ok   ', timing))
+            for d in diffs:
+                print('             ' + d)
+            failed += bool(diffs)
+
+    if args.update:
+        with open(GOLDEN, 'w', newline='') as f:
+            w = csv.DictWriter(f, FIELDS, lineterminator='\n')
+            w.writeheader()
+            for name in configs():
+                if name in golden:
+                    w.writerow(golden[name])
+
+    if args.bench and benches:
+        fields = ['date', 'config', 'threads', 'wall_s', 'cpu_s', 'candidates',
+                  'candidates_per_s', 'peak_rss_kb']
+        new = not os.path.exists(args.bench)
+        with open(args.bench, 'a', newline='') as f:
+            w = csv.DictWriter(f, fields, lineterminator='\n')
+            if new:
+                w.writeheader()
+            stamp = time.strftime('%Y-%m-%d %H:%M:%S')
+            for b in benches:
+                b['date'] = stamp
+                w.writerow(b)
+
+    total = sum(float(b['wall_s']) for b in benches)
+    print('%d of %d configs failed, %.1fs' % (failed, len(names), total))
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
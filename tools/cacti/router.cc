@@ -157,6 +157,7 @@ void Router::buffer_stats()
   dyn_p.Ndsam_lev_1 = 1;
   dyn_p.Ndsam_lev_2 = 1;
   dyn_p.Ndcm = 1;
+  dyn_p.wtype = g_ip->wt;
   dyn_p.number_addr_bits_mat = 8;
   dyn_p.number_way_select_signals_mat = 1;
   dyn_p.number_subbanks_decode = 0;
@@ -0,0 +1,268 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#include "server.h"
+#include "sweep.h"
+#include "io.h"
+#include "parameter.h"
+#include "thread_pool.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+
+static InputParameter * base_ip;
+
+// solver contexts not taken by a request; there are as many as threads in
+// the pool, which also caps the number of solves running at once
+static pthread_mutex_t slot_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  slot_cv   = PTHREAD_COND_INITIALIZER;
+static vector<sweep_slot *> free_slots;
+
+
+static sweep_slot * take_slot()
+{
+  pthread_mutex_lock(&slot_lock);
+  while (free_slots.empty())
+  {
+    pthread_cond_wait(&slot_cv, &slot_lock);
+  }
+  sweep_slot * s = free_slots.back();
+  free_slots.pop_back();
+  pthread_mutex_unlock(&slot_lock);
+  return s;
+}
+
+static void give_slot(sweep_slot * s)
+{
+  pthread_mutex_lock(&slot_lock);
+  free_slots.push_back(s);
+  pthread_cond_signal(&slot_cv);
+  pthread_mutex_unlock(&slot_lock);
+}
+
+
+
+static void output_array_json(ostream & os, const mem_array * a)
+{
+  os << "{\"Ndwl\": " << a->Ndwl
+     << ", \"Ndbl\": " << a->Ndbl
+     << ", \"Nspd\": " << a->Nspd
+     << ", \"Ndcm\": " << a->deg_bl_muxing
+     << ", \"Ndsam_level_1\": " << a->Ndsam_lev_1
+     << ", \"Ndsam_level_2\": " << a->Ndsam_lev_2
+     << ", \"access_time_ns\": " << a->access_time*1e+9
+     << ", \"area_efficiency\": " << a->area_efficiency << "}";
+}
+
+// The metrics of output_data_csv_row() as one line of JSON.
+static void output_data_json(ostream & os, const InputParameter & ip, const uca_org_t & fin_res)
+{
+  os << setprecision(12);
+  os << "{\"valid\": true";
+  os << ", \"access_time_ns\": " << fin_res.access_time*1e+9;
+  os << ", \"cycle_time_ns\": " << fin_res.cycle_time*1e+9;
+  if (ip.fully_assoc || ip.pure_cam)
+  {
+    os << ", \"search_energy_nJ\": " << fin_res.power.searchOp.dynamic*1e+9;
+  }
+  os << ", \"read_energy_nJ\": " << fin_res.power.readOp.dynamic*1e+9;
+  os << ", \"write_energy_nJ\": " << fin_res.power.writeOp.dynamic*1e+9;
+  os << ", \"leakage_mW\": " << (fin_res.power.readOp.leakage + fin_res.power.readOp.gate_leakage)*1000;
+  os << ", \"area_mm2\": " << fin_res.area*1e-6;
+  os << ", \"data\": ";
+  output_array_json(os, fin_res.data_array2);
+  if (!(ip.fully_assoc || ip.pure_cam || ip.pure_ram))
+  {
+    os << ", \"tag\": ";
+    output_array_json(os, fin_res.tag_array2);
+  }
+}
+
+static string answer(const vector<string> & lines)
+{
+  struct timespec t0, t1;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+
+  InputParameter ip(*base_ip);
+  ip.parse_cfg(lines);
+
+  sweep_slot * s = take_slot();
+  uca_org_t fin_res;
+  const char * error = solve_on_slot(*s, ip, fin_res);
+  give_slot(s);
+
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+  ostringstream os;
+  if (error != NULL)
+  {
+    os << "{\"valid\": false, \"error\": \"" << error << "\"";
+  }
+  else
+  {
+    output_data_json(os, ip, fin_res);
+    fin_res.cleanup();
+  }
+  os << ", \"solve_s\": " << setprecision(6) << secs << "}\n";
+  return os.str();
+}
+
+
+
+static bool send_all(int fd, const string & s)
+{
+  size_t done = 0;
+  while (done < s.size())
+  {
+    ssize_t n = send(fd, s.data() + done, s.size() - done, 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    done += n;
+  }
+  return true;
+}
+
+// Serves the requests of one connection until the client closes it.
+static void * serve_connection(void * arg)
+{
+  int fd = (int) (intptr_t) arg;
+  char buf[4096];
+  string pending;
+  vector<string> lines;
+
+  while (true)
+  {
+    size_t eol;
+    while ((eol = pending.find('\n')) != string::npos)
+    {
+      string line = pending.substr(0, eol);
+      pending.erase(0, eol + 1);
+      if (!line.empty() && line[line.size() - 1] == '\r')
+      {
+        line.erase(line.size() - 1);
+      }
+
+      if (!line.empty())
+      {
+        if (line[0] != '#') lines.push_back(line);
+      }
+      else
+      {
+        if (!send_all(fd, answer(lines)))
+        {
+          close(fd);
+          return NULL;
+        }
+        lines.clear();
+      }
+    }
+
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    pending.append(buf, n);
+  }
+  close(fd);
+  return NULL;
+}
+
+
+
+void serve_interface(const string & infile_name, const string & socket_name)
+{
+  base_ip = new InputParameter();
+  base_ip->parse_cfg(infile_name);
+
+  uint32_t nslots = ThreadPool::instance().num_slots();
+  for (uint32_t i = 0; i < nslots; i++)
+  {
+    free_slots.push_back(new sweep_slot());
+  }
+
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (socket_name.size() >= sizeof(addr.sun_path))
+  {
+    cerr << "Socket path " << socket_name << " is too long" << endl;
+    exit(1);
+  }
+  strcpy(addr.sun_path, socket_name.c_str());
+
+  int lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+  unlink(socket_name.c_str());
+  if (lfd < 0 || bind(lfd, (struct sockaddr *) &addr, sizeof(addr)) != 0 || listen(lfd, 64) != 0)
+  {
+    cerr << "Unable to listen on " << socket_name << ": " << strerror(errno) << endl;
+    exit(1);
+  }
+  // a client going away mid-answer must not end the service
+  signal(SIGPIPE, SIG_IGN);
+  cout << "Serving on " << socket_name << " with " << nslots << " threads" << endl;
+
+  while (true)
+  {
+    int fd = accept(lfd, NULL, NULL);
+    if (fd < 0)
+    {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      cerr << "accept failed: " << strerror(errno) << endl;
+      exit(1);
+    }
+
+    pthread_t t;
+    if (pthread_create(&t, NULL, serve_connection, (void *) (intptr_t) fd) != 0)
+    {
+      cerr << "Unable to create connection thread" << endl;
+      close(fd);
+      continue;
+    }
+    pthread_detach(t);
+  }
+}
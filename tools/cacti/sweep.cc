@@ -0,0 +1,337 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#include "sweep.h"
+#include "io.h"
+#include "parameter.h"
+#include "wire.h"
+#include "Ucache.h"
+#include "thread_pool.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+
+static string trim(const string & s)
+{
+  size_t b = s.find_first_not_of(" \t");
+  size_t e = s.find_last_not_of(" \t");
+  return (b == string::npos) ? "" : s.substr(b, e - b + 1);
+}
+
+static string format_value(double v)
+{
+  ostringstream os;
+  os << setprecision(12) << v;
+  return os.str();
+}
+
+static void expand_range(const string & item, vector<string> & values)
+{
+  size_t c1 = item.find(':');
+  size_t c2 = item.find(':', c1 + 1);
+  if (c2 == string::npos)
+  {
+    cout << "Invalid sweep range \"" << item << "\", expected first:last:step" << endl;
+    exit(1);
+  }
+  double first = atof(item.substr(0, c1).c_str());
+  double last  = atof(item.substr(c1 + 1, c2 - c1 - 1).c_str());
+  string step  = trim(item.substr(c2 + 1));
+  bool   mult  = (!step.empty() && step[0] == '*');
+  double k     = atof(step.c_str() + (mult ? 1 : 0));
+
+  if ((mult && k <= 1) || (!mult && k <= 0))
+  {
+    cout << "Invalid sweep range \"" << item << "\", the step has to grow the value" << endl;
+    exit(1);
+  }
+  for (double v = first; v <= last * (1 + 1e-9); v = mult ? v * k : v + k)
+  {
+    values.push_back(format_value(v));
+  }
+}
+
+void parse_sweep(const string & sweep_file, vector<SweepAxis> & axes)
+{
+  vector<string> lines;
+  read_cfg_lines(sweep_file, lines);
+
+  for (unsigned int l = 0; l < lines.size(); l++)
+  {
+    const string & line = lines[l];
+    if (line[0] == '#')
+      continue;
+
+    SweepAxis axis;
+    size_t open  = line.find('{');
+    size_t close = line.find('}', open);
+    if (open == string::npos)
+    {
+      axis.prefix = line;
+      axis.values.push_back("");
+      axis.swept  = false;
+      axes.push_back(axis);
+      continue;
+    }
+    if (close == string::npos || line.find('{', open + 1) < close)
+    {
+      cout << "Invalid sweep line \"" << line << "\"" << endl;
+      exit(1);
+    }
+
+    axis.prefix = line.substr(0, open);
+    axis.suffix = line.substr(close + 1);
+    axis.swept  = true;
+
+    string list = line.substr(open + 1, close - open - 1);
+    size_t pos  = 0;
+    while (pos <= list.size())
+    {
+      size_t comma = list.find(',', pos);
+      if (comma == string::npos) comma = list.size();
+      string item = trim(list.substr(pos, comma - pos));
+      if (item.find(':') != string::npos)
+        expand_range(item, axis.values);
+      else if (!item.empty())
+        axis.values.push_back(item);
+      pos = comma + 1;
+    }
+    if (axis.values.empty())
+    {
+      cout << "Sweep line \"" << line << "\" has no values" << endl;
+      exit(1);
+    }
+    axes.push_back(axis);
+  }
+}
+
+
+// The wire models only depend on these inputs (through g_tp), so a worker
+// keeps them while consecutive points share the technology.
+static bool same_wire_tech(const InputParameter & a, const InputParameter & b)
+{
+  return a.F_sz_um == b.F_sz_um &&
+         a.temp == b.temp &&
+         a.data_arr_ram_cell_tech_type == b.data_arr_ram_cell_tech_type &&
+         a.data_arr_peri_global_tech_type == b.data_arr_peri_global_tech_type &&
+         a.tag_arr_ram_cell_tech_type == b.tag_arr_ram_cell_tech_type &&
+         a.tag_arr_peri_global_tech_type == b.tag_arr_peri_global_tech_type &&
+         a.ic_proj_type == b.ic_proj_type &&
+         a.wire_is_mat_type == b.wire_is_mat_type &&
+         a.wire_os_mat_type == b.wire_os_mat_type;
+}
+
+// init_tech_params() exits on nodes it has no tech files for, which would
+// end the whole sweep; such points are reported as invalid instead.
+static bool tech_supported(const InputParameter & ip, TechnologyParameter & tp)
+{
+  int    tech_lo, tech_hi;
+  string in_file_lo, in_file_hi;
+
+  if (!tp.find_upper_and_lower_tech(ip.F_sz_um * 1000.0, tech_lo, in_file_lo, tech_hi, in_file_hi))
+  {
+    return false;
+  }
+  return !(tech_lo == 22 && tech_hi == 22 &&
+           (ip.data_arr_ram_cell_tech_type == 3 ||
+            (ip.tag_arr_ram_cell_tech_type == 3 && !(ip.pure_ram || ip.pure_cam || ip.fully_assoc))));
+}
+
+struct sweep_mt_struct
+{
+  const InputParameter *     base;
+  const vector<SweepAxis> *  axes;
+  uint64_t                   first;   // first point of the current chunk
+  vector<string>             rows;
+  vector<sweep_slot *>       slot;
+};
+
+const char * solve_on_slot(sweep_slot & s, InputParameter & ip, uca_org_t & fin_res)
+{
+  const char * error = NULL;
+
+  ip.tsv_is_subarray_type = ip.TSV_proj_type;
+  ip.tsv_os_bank_type     = ip.TSV_proj_type;
+  fin_res.valid = false;
+
+  s.ctx.ip = &ip;
+  SolverContext * prev = s.ctx.bind();
+  if (!ip.error_checking() || !tech_supported(ip, s.ctx.tp))
+  {
+    error = "invalid configuration";
+  }
+  else
+  {
+    init_tech_params(ip.F_sz_um, false);
+    if (!s.has_wires || !same_wire_tech(s.wire_tech, ip))
+    {
+      Wire winit;
+      s.wire_tech = ip;
+      s.has_wires = true;
+    }
+
+    if (!solve(&fin_res, false))
+    {
+      error = "no valid organization";
+    }
+  }
+  prev->bind();
+  s.ctx.ip = NULL;
+  return error;
+}
+
+// Point index -> one value per axis, the last axis varying fastest.
+static void point_lines(const vector<SweepAxis> & axes, uint64_t point,
+    vector<string> & lines, vector<string> & values)
+{
+  lines.resize(axes.size());
+  for (int a = axes.size() - 1; a >= 0; a--)
+  {
+    uint32_t n = axes[a].values.size();
+    lines[a] = axes[a].line(point % n);
+    if (axes[a].swept)
+      values.insert(values.begin(), axes[a].values[point % n]);
+    point /= n;
+  }
+}
+
+void sweep_point_mt(void * void_obj, uint64_t idx, uint32_t slot)
+{
+  sweep_mt_struct * obj = (sweep_mt_struct *) void_obj;
+  sweep_slot & s = *obj->slot[slot];
+  uint64_t point = obj->first + idx;
+
+  vector<string> lines, values;
+  point_lines(*obj->axes, point, lines, values);
+
+  InputParameter ip(*obj->base);
+  ip.parse_cfg(lines);
+
+  ostringstream row;
+  row << point << ", ";
+  for (unsigned int v = 0; v < values.size(); v++)
+  {
+    row << values[v] << ", ";
+  }
+
+  uca_org_t fin_res;
+  const char * error = solve_on_slot(s, ip, fin_res);
+  if (error != NULL)
+  {
+    row << error << endl;
+  }
+  else
+  {
+    s.ctx.ip = &ip;
+    SolverContext * prev = s.ctx.bind();
+    output_data_csv_row(row, fin_res);
+    prev->bind();
+    s.ctx.ip = NULL;
+    fin_res.cleanup();
+  }
+
+  obj->rows[idx] = row.str();
+}
+
+void sweep_interface(const string & infile_name, const string & sweep_file)
+{
+  InputParameter base;
+  base.parse_cfg(infile_name);
+
+  vector<SweepAxis> axes;
+  parse_sweep(sweep_file, axes);
+
+  uint64_t npoints = 1;
+  for (unsigned int a = 0; a < axes.size(); a++)
+  {
+    npoints *= axes[a].values.size();
+  }
+
+  string out_name = sweep_file + ".out";
+  ofstream out(out_name.c_str());
+  if (out.fail())
+  {
+    cerr << "File " << out_name << " could not be opened successfully" << endl;
+    exit(1);
+  }
+
+  out << "Point, ";
+  for (unsigned int a = 0; a < axes.size(); a++)
+  {
+    if (!axes[a].swept) continue;
+    string name = axes[a].prefix;
+    size_t e = name.find_last_not_of(" \t\"-");
+    name = name.substr(1, (e == string::npos) ? 0 : e);
+    out << name << ", ";
+  }
+  output_data_csv_header(out);
+
+  ThreadPool & pool = ThreadPool::instance();
+  sweep_mt_struct obj;
+  obj.base = &base;
+  obj.axes = &axes;
+  for (uint32_t i = 0; i < pool.num_slots(); i++)
+  {
+    obj.slot.push_back(new sweep_slot());
+  }
+
+  // solve a few points per thread at a time so rows come out in order
+  // while the sweep is running
+  uint64_t chunk = 4 * pool.num_slots();
+  for (obj.first = 0; obj.first < npoints; obj.first += chunk)
+  {
+    uint64_t n = min(chunk, npoints - obj.first);
+    obj.rows.assign(n, string());
+    pool.parallel_for(n, sweep_point_mt, (void *) &obj);
+    for (uint64_t i = 0; i < n; i++)
+    {
+      out << obj.rows[i];
+    }
+    out.flush();
+  }
+
+  for (uint32_t i = 0; i < obj.slot.size(); i++)
+  {
+    delete obj.slot[i];
+  }
+  cout << "Solved " << npoints << " sweep points, results are in " << out_name << endl;
+}
@@ -0,0 +1,88 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+
+#ifndef __SWEEP_H__
+#define __SWEEP_H__
+
+#include <string>
+#include <vector>
+
+#include "parameter.h"
+
+using namespace std;
+
+
+// A line of a sweep specification. It is a config file line whose "{...}"
+// field lists the values to sweep, e.g.
+//   -size (bytes) {1024:65536:*2}
+//   -associativity {1,2,4}
+//   -technology (u) {0.032,0.045}
+// A range "first:last:step" adds step to the value, or multiplies it when
+// the step is written as "*k". Lines without a field override the base
+// config for every point.
+class SweepAxis
+{
+  public:
+    string prefix;
+    string suffix;
+    vector<string> values;
+    bool swept;
+
+    string line(unsigned int i) const { return prefix + values[i] + suffix; }
+};
+
+void parse_sweep(const string & sweep_file, vector<SweepAxis> & axes);
+
+// Batch mode: solves every point of the cartesian product of the sweep
+// axes on top of the base config and streams one csv row per point, in
+// order, to <sweep_file>.out. Points are solved in parallel; tech and wire
+// state is kept per worker and reused while the technology does not change.
+void sweep_interface(const string & infile_name, const string & sweep_file);
+
+// Solver context of a worker that keeps its wire models from one solve to
+// the next while the technology does not change.
+struct sweep_slot
+{
+  SolverContext  ctx;
+  InputParameter wire_tech;   // inputs the context's wire models were built for
+  bool           has_wires;
+
+  sweep_slot() : has_wires(false) { }
+};
+
+// Error checks and solves ip on the slot's context. Returns NULL with the
+// result in fin_res, or why there is none.
+const char * solve_on_slot(sweep_slot & s, InputParameter & ip, uca_org_t & fin_res);
+
+#endif
@@ -33,11 +33,13 @@
 #include "basic_circuit.h"
 
 #include "parameter.h"
+#include "profile.h"
 
 #include <cmath>
 void init_tech_params(double technology, bool is_tag)
 {
-  g_tp.init(technology,is_tag);
+  ProfilePhase prof(PROF_TECH_INIT);
+  g_tp.load(technology,is_tag);
 }
 
 void printing(const char * name, double value)
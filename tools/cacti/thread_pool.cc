@@ -0,0 +1,286 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+#include "thread_pool.h"
+#include "parameter.h"
+#include "profile.h"
+
+#include <unistd.h>
+#include <iostream>
+#include <cstdlib>
+
+using namespace std;
+
+
+uint32_t     ThreadPool::requested_size = 0;
+ThreadPool * ThreadPool::pool           = NULL;
+
+// slot of the current thread while it runs a task, -1 otherwise
+static __thread int pool_slot = -1;
+
+
+uint32_t ThreadPool::default_size()
+{
+#ifdef NTHREADS
+  return NTHREADS;
+#else
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  return (ncpu > 0) ? (uint32_t) ncpu : 1;
+#endif
+}
+
+
+
+void ThreadPool::set_size(uint32_t n)
+{
+  if (pool != NULL && pool->nslots != n)
+  {
+    cerr << "Thread pool already running with " << pool->nslots << " threads\n";
+    return;
+  }
+  requested_size = n;
+}
+
+
+
+ThreadPool & ThreadPool::instance()
+{
+  static pthread_mutex_t create_lock = PTHREAD_MUTEX_INITIALIZER;
+
+  pthread_mutex_lock(&create_lock);
+  if (pool == NULL)
+  {
+    pool = new ThreadPool((requested_size > 0) ? requested_size : default_size());
+  }
+  pthread_mutex_unlock(&create_lock);
+  return *pool;
+}
+
+
+
+ThreadPool::ThreadPool(uint32_t n)
+ :nslots(n > 0 ? n : 1)
+{
+  pthread_mutex_init(&lock, NULL);
+  pthread_cond_init(&work_cv, NULL);
+  pthread_cond_init(&done_cv, NULL);
+
+  // slot 0 is always the thread calling parallel_for()
+  threads.resize(nslots - 1);
+  for (uint32_t t = 0; t + 1 < nslots; t++)
+  {
+    if (pthread_create(&threads[t], NULL, worker_entry, (void *) this) != 0)
+    {
+      cerr << "Unable to create worker thread\n";
+      exit(1);
+    }
+    pthread_detach(threads[t]);
+  }
+}
+
+
+
+void * ThreadPool::worker_entry(void * p)
+{
+  ((ThreadPool *) p)->worker();
+  return NULL;
+}
+
+
+
+void ThreadPool::worker()
+{
+  pthread_mutex_lock(&lock);
+  while (true)
+  {
+    while (open_jobs.empty())
+    {
+      pthread_cond_wait(&work_cv, &lock);
+    }
+
+    job * j       = open_jobs.front();
+    uint32_t slot = j->next_slot++;
+    j->active++;
+    if (j->next_slot == nslots)
+    {
+      open_jobs.pop_front();
+    }
+    pthread_mutex_unlock(&lock);
+
+    SolverContext * prev = j->ctx->bind();
+    {
+      ProfilePhase prof(j->phase, true);
+      run_job(j, slot);
+    }
+    prev->bind();
+
+    pthread_mutex_lock(&lock);
+    if (--j->active == 0)
+    {
+      pthread_cond_broadcast(&done_cv);
+    }
+  }
+}
+
+
+
+// Take the next index of the job for the given slot. Each slot owns a
+// contiguous range and consumes it from the bottom; once it runs dry the
+// slot steals the upper half of the largest range still pending.
+bool ThreadPool::next_task(job * j, uint32_t slot, uint64_t & idx)
+{
+  range & own = j->ranges[slot];
+
+  pthread_mutex_lock(&own.lock);
+  if (own.lo < own.hi)
+  {
+    idx = own.lo++;
+    pthread_mutex_unlock(&own.lock);
+    return true;
+  }
+  pthread_mutex_unlock(&own.lock);
+
+  while (true)
+  {
+    uint32_t victim = nslots;
+    uint64_t most   = 0;
+    for (uint32_t v = 0; v < nslots; v++)
+    {
+      if (v == slot) continue;
+      pthread_mutex_lock(&j->ranges[v].lock);
+      uint64_t left = j->ranges[v].hi - j->ranges[v].lo;
+      pthread_mutex_unlock(&j->ranges[v].lock);
+      if (left > most)
+      {
+        most   = left;
+        victim = v;
+      }
+    }
+    if (victim == nslots)
+    {
+      return false;
+    }
+
+    range & r = j->ranges[victim];
+    uint64_t lo = 0, hi = 0;
+    pthread_mutex_lock(&r.lock);
+    if (r.lo < r.hi)
+    {
+      lo   = r.lo + (r.hi - r.lo)/2;
+      hi   = r.hi;
+      r.hi = lo;
+    }
+    pthread_mutex_unlock(&r.lock);
+
+    if (lo < hi)
+    {
+      idx = lo;
+      pthread_mutex_lock(&own.lock);
+      own.lo = lo + 1;
+      own.hi = hi;
+      pthread_mutex_unlock(&own.lock);
+      return true;
+    }
+  }
+}
+
+
+
+void ThreadPool::run_job(job * j, uint32_t slot)
+{
+  uint64_t idx;
+
+  pool_slot = slot;
+  while (next_task(j, slot, idx))
+  {
+    j->fn(j->arg, idx, slot);
+  }
+  pool_slot = -1;
+}
+
+
+
+void ThreadPool::parallel_for(uint64_t n, pool_task_fn fn, void * arg)
+{
+  if (n == 0)
+  {
+    return;
+  }
+
+  if (pool_slot >= 0 || nslots == 1)
+  {
+    uint32_t slot = (pool_slot >= 0) ? pool_slot : 0;
+    for (uint64_t i = 0; i < n; i++)
+    {
+      fn(arg, i, slot);
+    }
+    return;
+  }
+
+  job j;
+  j.fn        = fn;
+  j.arg       = arg;
+  j.ctx       = g_ctx;
+  j.ranges    = new range[nslots];
+  j.next_slot = 1;
+  j.active    = 1;
+  j.phase     = Profiler::current_phase();
+  for (uint32_t s = 0; s < nslots; s++)
+  {
+    pthread_mutex_init(&j.ranges[s].lock, NULL);
+    j.ranges[s].lo = n * s / nslots;
+    j.ranges[s].hi = n * (s + 1) / nslots;
+  }
+
+  pthread_mutex_lock(&lock);
+  open_jobs.push_back(&j);
+  pthread_cond_broadcast(&work_cv);
+  pthread_mutex_unlock(&lock);
+
+  run_job(&j, 0);
+
+  pthread_mutex_lock(&lock);
+  open_jobs.remove(&j);
+  j.active--;
+  while (j.active > 0)
+  {
+    pthread_cond_wait(&done_cv, &lock);
+  }
+  pthread_mutex_unlock(&lock);
+
+  for (uint32_t s = 0; s < nslots; s++)
+  {
+    pthread_mutex_destroy(&j.ranges[s].lock);
+  }
+  delete [] j.ranges;
+}
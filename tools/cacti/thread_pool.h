@@ -0,0 +1,109 @@
+/*****************************************************************************
+ *                                CACTI 7.0
+ *                      SOFTWARE LICENSE AGREEMENT
+ *            Copyright 2015 Hewlett-Packard Development Company, L.P.
+ *                          All Rights Reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.”
+ *
+ ***************************************************************************/
+
+
+
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <pthread.h>
+#include <stdint.h>
+#include <list>
+#include <vector>
+
+using namespace std;
+
+class SolverContext;
+
+// A task receives the index it has to evaluate and the slot of the thread
+// running it. Slots are dense in [0, ThreadPool::num_slots()) and no two
+// threads working on the same job share a slot, so callers can keep
+// per-slot result buffers without locking.
+typedef void (*pool_task_fn)(void * arg, uint64_t idx, uint32_t slot);
+
+
+class ThreadPool
+{
+  public:
+    // process-wide pool, created on first use
+    static ThreadPool & instance();
+
+    // number of threads (including the caller) used by the pool; only
+    // takes effect if called before the pool is first used
+    static void set_size(uint32_t n);
+    static uint32_t default_size();
+
+    uint32_t num_slots() const { return nslots; }
+
+    // runs fn(arg, i, slot) for every i in [0, n) and returns when all of
+    // them are done. The calling thread takes part as slot 0 and every task
+    // sees the caller's solver context. Calls made from inside a task are
+    // run inline on the calling thread's slot.
+    void parallel_for(uint64_t n, pool_task_fn fn, void * arg);
+
+  private:
+    struct range
+    {
+      pthread_mutex_t lock;
+      uint64_t lo;
+      uint64_t hi;
+    };
+
+    struct job
+    {
+      pool_task_fn fn;
+      void *       arg;
+      SolverContext * ctx;
+      range *      ranges;
+      uint32_t     next_slot;
+      uint32_t     active;
+      int          phase;  // profile phase of the caller
+    };
+
+    ThreadPool(uint32_t n);
+
+    bool next_task(job * j, uint32_t slot, uint64_t & idx);
+    void run_job(job * j, uint32_t slot);
+    void worker();
+    static void * worker_entry(void * pool);
+
+    uint32_t        nslots;
+    pthread_mutex_t lock;
+    pthread_cond_t  work_cv;
+    pthread_cond_t  done_cv;
+    list<job *>     open_jobs;  // jobs that still have free slots
+    vector<pthread_t> threads;
+
+    static uint32_t     requested_size;
+    static ThreadPool * pool;
+};
+
+#endif
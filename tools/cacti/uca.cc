@@ -39,8 +39,9 @@
 #include "memorybus.h"
 
 
-UCA::UCA(const DynamicParameter & dyn_p)
- :dp(dyn_p), bank(dp), nbanks(g_ip->nbanks), refresh_power(0)
+UCA::UCA(const DynamicParameter & dyn_p, bool defer_power)
+ :dp(dyn_p), bank(dp), nbanks(g_ip->nbanks),
+  power_deferred(defer_power && !g_ip->is_3d_mem), refresh_power(0)
 {
   int num_banks_ver_dir = 1 << ((bank.area.h > bank.area.w) ? _log2(nbanks)/2 : (_log2(nbanks) - _log2(nbanks)/2));
   int num_banks_hor_dir = nbanks/num_banks_ver_dir;
@@ -143,7 +144,9 @@ UCA::UCA(const DynamicParameter & dyn_p)
 	  // delay calculation
 	  double inrisetime = 0.0;
 	  compute_delays(inrisetime);
-	  compute_power_energy();
+	  // the caller finishes a deferred candidate only if it stays in contention
+	  if (!power_deferred)
+		  compute_power_energy();
 
 	if(g_ip->is_3d_mem)
 	{
@@ -355,6 +358,67 @@ UCA::~UCA()
 
 
 
+void UCA::bounds(const DynamicParameter & dyn_p, double & access_time,
+                 double & mat_energy, double & htree_energy)
+{
+  Area mat_area;
+  Mat::bitline_bounds(dyn_p, access_time, mat_energy, mat_area);
+  htree_energy = 0;
+  if (access_time == 0 || mat_energy == 0)
+  {
+    return;
+  }
+
+  int rwp = dyn_p.use_inp_params ? dyn_p.num_rw_ports : g_ip->num_rw_ports;
+  int erp = dyn_p.use_inp_params ? dyn_p.num_rd_ports : g_ip->num_rd_ports;
+  int ewp = dyn_p.use_inp_params ? dyn_p.num_wr_ports : g_ip->num_wr_ports;
+  int add_bits = (dyn_p.number_addr_bits_mat + dyn_p.number_subbanks_decode) * (rwp + erp + ewp);
+  int do_bits  = dyn_p.num_do_b_bank_per_port * (rwp + erp);
+  if (g_ip->fast_access)
+  {
+    do_bits *= g_ip->data_assoc;
+  }
+
+  // the trees inside a bank span its mats; the access goes down the address
+  // tree and back up the data-out tree, as in compute_delays()
+  double delay, energy;
+  int bl = dyn_p.num_mats_v_dir * 2;
+  int wl = dyn_p.num_mats_h_dir * 2;
+  Htree2::wire_bounds(dyn_p.wtype, mat_area.w, mat_area.h, add_bits, bl, wl, delay, energy);
+  access_time  += delay;
+  htree_energy += energy;
+  Htree2::wire_bounds(dyn_p.wtype, mat_area.w, mat_area.h, do_bits, bl, wl, delay, energy);
+  access_time  += delay;
+  htree_energy += energy;
+
+  // the trees between the banks; which way has more banks depends on the
+  // bank's aspect ratio, so take the cheaper of the two
+  int lg = _log2(g_ip->nbanks);
+  double bank_w = mat_area.w * dyn_p.num_mats_h_dir;
+  double bank_h = mat_area.h * dyn_p.num_mats_v_dir;
+  double min_delay = 0, min_energy = 0;
+  for (int tall = 0; tall < 2; tall++)
+  {
+    int banks_v = 1 << (tall ? lg/2 : lg - lg/2);
+    int banks_h = (1 << lg) / banks_v;
+    double d_add, e_add, d_do, e_do;
+    Htree2::wire_bounds(g_ip->wt, bank_w, bank_h, add_bits, banks_v*2, banks_h*2, d_add, e_add);
+    Htree2::wire_bounds(g_ip->wt, bank_w, bank_h, do_bits, banks_v*2, banks_h*2, d_do, e_do);
+    if (tall == 0 || d_add + d_do < min_delay)
+    {
+      min_delay = d_add + d_do;
+    }
+    if (tall == 0 || e_add + e_do < min_energy)
+    {
+      min_energy = e_add + e_do;
+    }
+  }
+  access_time  += min_delay;
+  htree_energy += min_energy;
+}
+
+
+
 double UCA::compute_delays(double inrisetime)
 {
   double outrisetime = bank.compute_delays(inrisetime);
@@ -538,6 +602,7 @@ double UCA::compute_delays(double inrisetime)
 // note: currently, power numbers are for a bank of an array
 void UCA::compute_power_energy()
 {
+  power_deferred = false;
   bank.compute_power_energy();
   power = bank.power;
   //CACTI3DD
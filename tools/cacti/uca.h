@@ -48,11 +48,19 @@
 class UCA : public Component
 {
   public:
-    UCA(const DynamicParameter & dyn_p);
+    UCA(const DynamicParameter & dyn_p, bool defer_power = false);
     ~UCA();
     double compute_delays(double inrisetime);  // returns outrisetime
     void   compute_power_energy();
 
+    // Lower bounds on the access time and read energy of a RAM data array
+    // organized as dyn_p, without building it: the bitlines (see
+    // Mat::bitline_bounds) plus the address and data-out H-trees to and
+    // inside the banks. The energy is split so the H-tree share can be
+    // replaced by the exact one once the array is built.
+    static void bounds(const DynamicParameter & dyn_p, double & access_time,
+                       double & mat_energy, double & htree_energy);
+
     DynamicParameter dp;
     Bank   bank;
 
@@ -83,6 +91,7 @@ class UCA : public Component
     double dyn_read_energy_from_open_page;
     double dyn_read_energy_remaining_words_in_burst;
 
+    bool   power_deferred;  // compute_power_energy() still to be called
     double refresh_power;  // only for DRAM
     double activate_energy;
     double read_energy;
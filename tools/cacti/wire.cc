@@ -30,7 +30,10 @@
  ***************************************************************************/
 
 #include "wire.h"
+#include "profile.h"
 #include "cmath"
+#include <map>
+#include <pthread.h>
 // use this constructor to calculate wire stats
 Wire::Wire(
     enum Wire_type wire_model,
@@ -44,11 +47,12 @@ Wire::Wire(
     ):wt(wire_model), wire_length(wl*1e-6), nsense(n), w_scale(w_s), s_scale(s_s),
     resistivity(resistivity), deviceType(dt)
 {
+  WireTables & tab = tables();
   wire_placement = wp;
   min_w_pmos     = deviceType->n_to_p_eff_curr_drv_ratio*g_tp.min_w_nmos_;
   in_rise_time   = 0;
   out_rise_time  = 0;
-  if (initialized != 1) {
+  if (tab.initialized != 1) {
     cout << "Wire not initialized. Initializing it with default values\n";
     Wire winit;
   }
@@ -64,22 +68,10 @@ Wire::Wire(
   assert(power.readOp.gate_leakage > 0);
 }
 
-    // the following values are for peripheral global technology
-    // specified in the input config file
-    Component Wire::global;
-    Component Wire::global_5;
-    Component Wire::global_10;
-    Component Wire::global_20;
-    Component Wire::global_30;
-    Component Wire::low_swing;
-
-    int Wire::initialized;
-    double Wire::wire_width_init;
-    double Wire::wire_spacing_init;
-
 
 Wire::Wire(double w_s, double s_s, enum Wire_placement wp, double resis, /*TechnologyParameter::*/DeviceType *dt)
 {
+  WireTables & tab = tables();
   w_scale        = w_s;
   s_scale        = s_s;
   deviceType     = dt;
@@ -101,10 +93,10 @@ Wire::Wire(double w_s, double s_s, enum Wire_placement wp, double resis, /*Techn
   wire_width   *= (w_scale * 1e-6/2) /* (m) */;
   wire_spacing *= (s_scale * 1e-6/2) /* (m) */;
 
-  initialized = 1;
+  tab.initialized = 1;
   init_wire();
-  wire_width_init = wire_width;
-  wire_spacing_init = wire_spacing;
+  tab.wire_width_init = wire_width;
+  tab.wire_spacing_init = wire_spacing;
 
   assert(power.readOp.dynamic > 0);
   assert(power.readOp.leakage > 0);
@@ -122,6 +114,7 @@ Wire::~Wire()
 void
 Wire::calculate_wire_stats()
 {
+  WireTables & tab = tables();
 
   if (wire_placement == outside_mat) {
     wire_width = g_tp.wire_outside_mat.pitch/2;
@@ -144,56 +137,56 @@ Wire::calculate_wire_stats()
 	  //    delay_optimal_wire();
 	  
 	  if (wt == Global) {
-		  delay = global.delay * wire_length;
-		  power.readOp.dynamic = global.power.readOp.dynamic * wire_length;
-		  power.readOp.leakage = global.power.readOp.leakage * wire_length;
-		  power.readOp.gate_leakage = global.power.readOp.gate_leakage * wire_length;
-		  repeater_spacing = global.area.w;
-		  repeater_size = global.area.h;
+		  delay = tab.global.delay * wire_length;
+		  power.readOp.dynamic = tab.global.power.readOp.dynamic * wire_length;
+		  power.readOp.leakage = tab.global.power.readOp.leakage * wire_length;
+		  power.readOp.gate_leakage = tab.global.power.readOp.gate_leakage * wire_length;
+		  repeater_spacing = tab.global.area.w;
+		  repeater_size = tab.global.area.h;
 		  area.set_area((wire_length/repeater_spacing) *
 				  compute_gate_area(INV, 1, min_w_pmos * repeater_size,
 						  g_tp.min_w_nmos_ * repeater_size, g_tp.cell_h_def));
 	  }
 	  else if (wt == Global_5) {
-		  delay = global_5.delay * wire_length;
-		  power.readOp.dynamic = global_5.power.readOp.dynamic * wire_length;
-		  power.readOp.leakage = global_5.power.readOp.leakage * wire_length;
-		  power.readOp.gate_leakage = global_5.power.readOp.gate_leakage * wire_length;
-		  repeater_spacing = global_5.area.w;
-		  repeater_size = global_5.area.h;
+		  delay = tab.global_5.delay * wire_length;
+		  power.readOp.dynamic = tab.global_5.power.readOp.dynamic * wire_length;
+		  power.readOp.leakage = tab.global_5.power.readOp.leakage * wire_length;
+		  power.readOp.gate_leakage = tab.global_5.power.readOp.gate_leakage * wire_length;
+		  repeater_spacing = tab.global_5.area.w;
+		  repeater_size = tab.global_5.area.h;
 		  area.set_area((wire_length/repeater_spacing) *
 				  compute_gate_area(INV, 1, min_w_pmos * repeater_size,
 						  g_tp.min_w_nmos_ * repeater_size, g_tp.cell_h_def));
 	  }
 	  else if (wt == Global_10) {
-		  delay = global_10.delay * wire_length;
-		  power.readOp.dynamic = global_10.power.readOp.dynamic * wire_length;
-		  power.readOp.leakage = global_10.power.readOp.leakage * wire_length;
-		  power.readOp.gate_leakage = global_10.power.readOp.gate_leakage * wire_length;
-		  repeater_spacing = global_10.area.w;
-		  repeater_size = global_10.area.h;
+		  delay = tab.global_10.delay * wire_length;
+		  power.readOp.dynamic = tab.global_10.power.readOp.dynamic * wire_length;
+		  power.readOp.leakage = tab.global_10.power.readOp.leakage * wire_length;
+		  power.readOp.gate_leakage = tab.global_10.power.readOp.gate_leakage * wire_length;
+		  repeater_spacing = tab.global_10.area.w;
+		  repeater_size = tab.global_10.area.h;
 		  area.set_area((wire_length/repeater_spacing) *
 				  compute_gate_area(INV, 1, min_w_pmos * repeater_size,
 						  g_tp.min_w_nmos_ * repeater_size, g_tp.cell_h_def));
 	  }
 	  else if (wt == Global_20) {
-		  delay = global_20.delay * wire_length;
-		  power.readOp.dynamic = global_20.power.readOp.dynamic * wire_length;
-		  power.readOp.leakage = global_20.power.readOp.leakage * wire_length;
-		  power.readOp.gate_leakage = global_20.power.readOp.gate_leakage * wire_length;
-		  repeater_spacing = global_20.area.w;
-		  repeater_size = global_20.area.h;
+		  delay = tab.global_20.delay * wire_length;
+		  power.readOp.dynamic = tab.global_20.power.readOp.dynamic * wire_length;
+		  power.readOp.leakage = tab.global_20.power.readOp.leakage * wire_length;
+		  power.readOp.gate_leakage = tab.global_20.power.readOp.gate_leakage * wire_length;
+		  repeater_spacing = tab.global_20.area.w;
+		  repeater_size = tab.global_20.area.h;
 		  area.set_area((wire_length/repeater_spacing) *
 				  compute_gate_area(INV, 1, min_w_pmos * repeater_size,
 						  g_tp.min_w_nmos_ * repeater_size, g_tp.cell_h_def));
 	  }
 	  else if (wt == Global_30) {
-		  delay = global_30.delay * wire_length;
-		  power.readOp.dynamic = global_30.power.readOp.dynamic * wire_length;
-		  power.readOp.leakage = global_30.power.readOp.leakage * wire_length;
-		  power.readOp.gate_leakage = global_30.power.readOp.gate_leakage * wire_length;
-		  repeater_spacing = global_30.area.w;
-		  repeater_size = global_30.area.h;
+		  delay = tab.global_30.delay * wire_length;
+		  power.readOp.dynamic = tab.global_30.power.readOp.dynamic * wire_length;
+		  power.readOp.leakage = tab.global_30.power.readOp.leakage * wire_length;
+		  power.readOp.gate_leakage = tab.global_30.power.readOp.gate_leakage * wire_length;
+		  repeater_spacing = tab.global_30.area.w;
+		  repeater_size = tab.global_30.area.h;
 		  area.set_area((wire_length/repeater_spacing) *
 				  compute_gate_area(INV, 1, min_w_pmos * repeater_size,
 						  g_tp.min_w_nmos_ * repeater_size, g_tp.cell_h_def));
@@ -605,11 +598,59 @@ void Wire::delay_optimal_wire ()
 
 
 
+// Repeated-wire tables already built, keyed by tables_key(). They only
+// depend on the technology and on the initialising wire's parameters, so
+// every solve with the same ones shares them.
+static pthread_mutex_t wire_table_lock = PTHREAD_MUTEX_INITIALIZER;
+static map<vector<double>, WireTables> wire_tables;
+
+bool Wire::tables_key(vector<double> & key)
+{
+  long dt_offset = (char *) deviceType - (char *) &g_tp;
+  if (g_tp.load_key.empty() || dt_offset < 0 ||
+      dt_offset >= (long) sizeof(TechnologyParameter))
+  {
+    return false;
+  }
+
+  key = g_tp.load_key;
+  key.push_back(w_scale);
+  key.push_back(s_scale);
+  key.push_back(wire_placement);
+  key.push_back(resistivity);
+  key.push_back(dt_offset);
+  return true;
+}
+
+
+
 // calculate power/delay values for wires with suboptimal repeater sizing/spacing
 void
 Wire::init_wire(){
+  ProfilePhase prof(PROF_WIRE_INIT);
+  WireTables & tab = tables();
   wire_length = 1;
   delay_optimal_wire();
+
+  vector<double> key;
+  bool shared = tables_key(key);
+  tab.key.clear();
+  if (shared)
+  {
+    pthread_mutex_lock(&wire_table_lock);
+    map<vector<double>, WireTables>::const_iterator it = wire_tables.find(key);
+    bool found = (it != wire_tables.end());
+    if (found)
+    {
+      tab = it->second;
+    }
+    pthread_mutex_unlock(&wire_table_lock);
+    if (found)
+    {
+      return;
+    }
+  }
+
     double sp, si;
   powerDef pow;
   si = repeater_size;
@@ -617,92 +658,173 @@ Wire::init_wire(){
   sp *= 1e6; // in microns
 
   double i, j, del;
-  repeated_wire.push_back(Component());
+  if (si > 1) {
+    pow = wire_model(sp*1e-6, si, &del);
+    tab.global.delay = del;
+    tab.global.power = pow;
+    tab.global.area.h = si;
+    tab.global.area.w = sp*1e-6; // m
+  }
+
+  // the leakage of a repeater does not depend on its spacing
+  double beta = pmos_to_nmos_sz_ratio();
+  vector<double> size, nw, pw;
+  for (i = si; i > 1; i--) {
+    size.push_back(i);
+    nw.push_back(g_tp.min_w_nmos_*i);
+    pw.push_back(beta*g_tp.min_w_nmos_*i);
+  }
+
+  int n = size.size();
+  vector<double> i_sub(n), i_g(n);
+  if (n > 0) {
+    cmos_Isub_leakage_batch(n, &nw[0], &pw[0], 1, inv, &i_sub[0]);
+    cmos_Ig_leakage_batch(n, &nw[0], &pw[0], 1, inv, &i_g[0]);
+  }
+  int rows = 0;
   for (j=sp; j < 4*sp; j+=100) {
-    for (i = si; i > 1; i--) {
-      pow = wire_model(j*1e-6, i, &del);
-      if (j == sp && i == si) {
-        global.delay = del;
-        global.power = pow;
-        global.area.h = si;
-        global.area.w = sp*1e-6; // m
-      }
-//      cout << "Repeater size - "<< i <<
-//        " Repeater spacing - " << j <<
-//        " Delay - " << del <<
-//        " PowerD - " << pow.readOp.dynamic <<
-//        " PowerL - " << pow.readOp.leakage <<endl;
-      repeated_wire.back().delay = del;
-      repeated_wire.back().power.readOp = pow.readOp;
-      repeated_wire.back().area.w = j*1e-6; //m
-      repeated_wire.back().area.h = i;
-      repeated_wire.push_back(Component());
+    rows++;
+  }
 
+  RepeatedWireTable rw;
+  rw.spacing.resize(rows*n);
+  rw.size.resize(rows*n);
+  rw.delay.resize(rows*n);
+  rw.dynamic.resize(rows*n);
+  rw.leakage.resize(rows*n);
+  rw.gate_leakage.resize(rows*n);
+  int row = 0;
+  for (j=sp; j < 4*sp && n > 0; j+=100, row++) {
+    int k = row*n;
+    wire_model_batch(j*1e-6, n, &size[0], &i_sub[0], &i_g[0], &rw.delay[k],
+                     &rw.dynamic[k], &rw.leakage[k], &rw.gate_leakage[k]);
+    for (int m = 0; m < n; m++) {
+      rw.spacing[k+m] = j*1e-6; //m
+      rw.size[k+m] = size[m];
     }
   }
-  repeated_wire.pop_back();
-  update_fullswing();
+  update_fullswing(rw);
   Wire *l_wire = new Wire(Low_swing, 0.001/* 1 mm*/, 1);
-  low_swing.delay = l_wire->delay;
-  low_swing.power = l_wire->power;
+  tab.low_swing.delay = l_wire->delay;
+  tab.low_swing.power = l_wire->power;
   delete l_wire;
+
+  if (shared)
+  {
+    tab.key = key;
+    pthread_mutex_lock(&wire_table_lock);
+    wire_tables.insert(make_pair(key, tab));
+    pthread_mutex_unlock(&wire_table_lock);
+  }
 }
 
 
 
-void Wire::update_fullswing()
+void Wire::update_fullswing(const RepeatedWireTable & rw)
 {
+  WireTables & tab = tables();
 
-  list<Component>::iterator citer;
+  Component * point[4];
+  point[0] = &tab.global_5;
+  point[1] = &tab.global_10;
+  point[2] = &tab.global_20;
+  point[3] = &tab.global_30;
   double del[4];
-  del[3] = this->global.delay + this->global.delay*.3;
-  del[2] = global.delay + global.delay*.2;
-  del[1] = global.delay + global.delay*.1;
-  del[0] = global.delay + global.delay*.05;
-  double threshold;
+  del[3] = tab.global.delay + tab.global.delay*.3;
+  del[2] = tab.global.delay + tab.global.delay*.2;
+  del[1] = tab.global.delay + tab.global.delay*.1;
+  del[0] = tab.global.delay + tab.global.delay*.05;
+  double cost[4];
+  int best[4];
+  for (int i = 0; i < 4; i++) {
+    cost[i] = BIGNUM;
+    best[i] = -1;
+  }
+
+  // the delay limits are nested, so a single pass finds the cheapest point
+  // within each of them
   double ncost;
-  double cost;
-  int i = 4;
-  while (i>0) {
-    threshold = del[i-1];
-    cost = BIGNUM;
-    for (citer = repeated_wire.begin(); citer != repeated_wire.end(); citer++)
-    {
-      if (citer->delay > threshold) {
-        citer = repeated_wire.erase(citer);
-        citer --;
-      }
-      else {
-        ncost = citer->power.readOp.dynamic/global.power.readOp.dynamic +
-                citer->power.readOp.leakage/global.power.readOp.leakage;
-        if(ncost < cost)
-        {
-          cost = ncost;
-          if (i == 4) {
-            global_30.delay = citer->delay;
-            global_30.power = citer->power;
-            global_30.area  = citer->area;
-          }
-          else if (i==3) {
-            global_20.delay = citer->delay;
-            global_20.power = citer->power;
-            global_20.area  = citer->area;
-          }
-          else if(i==2) {
-            global_10.delay = citer->delay;
-            global_10.power = citer->power;
-            global_10.area  = citer->area;
-          }
-          else if(i==1) {
-            global_5.delay = citer->delay;
-            global_5.power = citer->power;
-            global_5.area  = citer->area;
-          }
-        }
+  int n = rw.delay.size();
+  for (int k = 0; k < n; k++) {
+    if (rw.delay[k] > del[3]) {
+      continue;
+    }
+    ncost = rw.dynamic[k]/tab.global.power.readOp.dynamic +
+            rw.leakage[k]/tab.global.power.readOp.leakage;
+    for (int i = 0; i < 4; i++) {
+      if (rw.delay[k] <= del[i] && ncost < cost[i]) {
+        cost[i] = ncost;
+        best[i] = k;
       }
     }
-    i--;
   }
+
+  for (int i = 0; i < 4; i++) {
+    if (best[i] < 0) {
+      continue;
+    }
+    int k = best[i];
+    point[i]->delay = rw.delay[k];
+    point[i]->power = powerDef();
+    point[i]->power.readOp.dynamic = rw.dynamic[k];
+    point[i]->power.readOp.leakage = rw.leakage[k];
+    point[i]->power.readOp.gate_leakage = rw.gate_leakage[k];
+    point[i]->area = Area();
+    point[i]->area.w = rw.spacing[k];
+    point[i]->area.h = rw.size[k];
+  }
+}
+
+
+
+// wire_model() for every repeater size at one spacing. The terms that do
+// not depend on the repeater are worked out once and the leakage currents
+// come precomputed per size, so the loop body is plain arithmetic.
+void Wire::wire_model_batch(double space, int n, const double *size,
+                            const double *i_sub, const double *i_g, double *delay,
+                            double *dynamic, double *leakage, double *gate_leakage)
+{
+  double len = 1;
+  // input cap of min sized driver
+  double input_cap = gate_C (g_tp.min_w_nmos_ +
+      min_w_pmos, 0);
+
+   // output parasitic capacitance of
+   // the min. sized driver
+  double out_cap = drain_C_(min_w_pmos, PCH, 1, 1, g_tp.cell_h_def) +
+    drain_C_(g_tp.min_w_nmos_, NCH, 1, 1, g_tp.cell_h_def);
+  // drive resistance
+  double out_res = (tr_R_on(g_tp.min_w_nmos_, NCH, 1) +
+      tr_R_on(min_w_pmos, PCH, 1))/2;
+  double wr = wire_res(len); //ohm
+
+  // wire cap /m
+  double wc = wire_cap(len);
+
+  double vdd = deviceType->Vdd;
+  double driver_cap = input_cap + out_cap;
+  double wire_switching = space * (wc/len);
+  double tc_driver = out_res * driver_cap;
+  double tc_driver_wire = out_res * wc/len * space;
+  double tc_wire_repeater = wr/len * space * out_cap;
+  double tc_wire = 0.5 * (wr/len) * (wc/len)* space * space;
+  double short_ckt_i = vdd * g_tp.min_w_nmos_ * Ishort_ckt * 1.0986;
+  double segments = len/space;
+  double leakage_v = segments * vdd;
+
+  for (int k = 0; k < n; k++) {
+    double switching = (size[k] * driver_cap + wire_switching) * vdd * vdd;
+    double tc = tc_driver + tc_driver_wire/size[k] + tc_wire_repeater * size[k] +
+      tc_wire;
+    delay[k] = 0.693 * tc * len/space;
+    double short_ckt = short_ckt_i * size[k] * tc;
+    dynamic[k] = segments * (switching + short_ckt);
+    leakage[k] = leakage_v * i_sub[k];
+    gate_leakage[k] = leakage_v * i_g[k];
+  }
+
+  repeater_spacing = space;
+  repeater_size = size[n-1];
 }
 
 
@@ -767,62 +889,63 @@ powerDef Wire::wire_model (double space, double size, double *delay)
 void
 Wire::print_wire()
 {
+  WireTables & tab = tables();
 
   cout << "\nWire Properties:\n\n";
-  cout << "  Delay Optimal\n\tRepeater size - "<< global.area.h <<
-    " \n\tRepeater spacing - " << global.area.w*1e3 << " (mm)"
-    " \n\tDelay - " << global.delay*1e6 <<  " (ns/mm)"
-    " \n\tPowerD - " << global.power.readOp.dynamic *1e6<< " (nJ/mm)"
-    " \n\tPowerL - " << global.power.readOp.leakage << " (mW/mm)"
-    " \n\tPowerLgate - " << global.power.readOp.gate_leakage << " (mW/mm)\n";
-  cout << "\tWire width - " <<wire_width_init*1e6 << " microns\n";
-  cout << "\tWire spacing - " <<wire_spacing_init*1e6 << " microns\n";
+  cout << "  Delay Optimal\n\tRepeater size - "<< tab.global.area.h <<
+    " \n\tRepeater spacing - " << tab.global.area.w*1e3 << " (mm)"
+    " \n\tDelay - " << tab.global.delay*1e6 <<  " (ns/mm)"
+    " \n\tPowerD - " << tab.global.power.readOp.dynamic *1e6<< " (nJ/mm)"
+    " \n\tPowerL - " << tab.global.power.readOp.leakage << " (mW/mm)"
+    " \n\tPowerLgate - " << tab.global.power.readOp.gate_leakage << " (mW/mm)\n";
+  cout << "\tWire width - " <<tab.wire_width_init*1e6 << " microns\n";
+  cout << "\tWire spacing - " <<tab.wire_spacing_init*1e6 << " microns\n";
   cout <<endl;
 
-  cout << "  5% Overhead\n\tRepeater size - "<< global_5.area.h <<
-    " \n\tRepeater spacing - " << global_5.area.w*1e3 << " (mm)"
-    " \n\tDelay - " << global_5.delay *1e6<<  " (ns/mm)"
-    " \n\tPowerD - " << global_5.power.readOp.dynamic *1e6<< " (nJ/mm)"
-    " \n\tPowerL - " << global_5.power.readOp.leakage << " (mW/mm)"
-    " \n\tPowerLgate - " << global_5.power.readOp.gate_leakage << " (mW/mm)\n";
-  cout << "\tWire width - " <<wire_width_init*1e6 << " microns\n";
-  cout << "\tWire spacing - " <<wire_spacing_init*1e6 << " microns\n";
+  cout << "  5% Overhead\n\tRepeater size - "<< tab.global_5.area.h <<
+    " \n\tRepeater spacing - " << tab.global_5.area.w*1e3 << " (mm)"
+    " \n\tDelay - " << tab.global_5.delay *1e6<<  " (ns/mm)"
+    " \n\tPowerD - " << tab.global_5.power.readOp.dynamic *1e6<< " (nJ/mm)"
+    " \n\tPowerL - " << tab.global_5.power.readOp.leakage << " (mW/mm)"
+    " \n\tPowerLgate - " << tab.global_5.power.readOp.gate_leakage << " (mW/mm)\n";
+  cout << "\tWire width - " <<tab.wire_width_init*1e6 << " microns\n";
+  cout << "\tWire spacing - " <<tab.wire_spacing_init*1e6 << " microns\n";
   cout <<endl;
-  cout << "  10% Overhead\n\tRepeater size - "<< global_10.area.h <<
-    " \n\tRepeater spacing - " << global_10.area.w*1e3 << " (mm)"
-    " \n\tDelay - " << global_10.delay *1e6<<  " (ns/mm)"
-    " \n\tPowerD - " << global_10.power.readOp.dynamic *1e6<< " (nJ/mm)"
-    " \n\tPowerL - " << global_10.power.readOp.leakage << " (mW/mm)"
-    " \n\tPowerLgate - " << global_10.power.readOp.gate_leakage << " (mW/mm)\n";
-  cout << "\tWire width - " <<wire_width_init*1e6 << " microns\n";
-  cout << "\tWire spacing - " <<wire_spacing_init*1e6 << " microns\n";
+  cout << "  10% Overhead\n\tRepeater size - "<< tab.global_10.area.h <<
+    " \n\tRepeater spacing - " << tab.global_10.area.w*1e3 << " (mm)"
+    " \n\tDelay - " << tab.global_10.delay *1e6<<  " (ns/mm)"
+    " \n\tPowerD - " << tab.global_10.power.readOp.dynamic *1e6<< " (nJ/mm)"
+    " \n\tPowerL - " << tab.global_10.power.readOp.leakage << " (mW/mm)"
+    " \n\tPowerLgate - " << tab.global_10.power.readOp.gate_leakage << " (mW/mm)\n";
+  cout << "\tWire width - " <<tab.wire_width_init*1e6 << " microns\n";
+  cout << "\tWire spacing - " <<tab.wire_spacing_init*1e6 << " microns\n";
   cout <<endl;
-  cout << "  20% Overhead\n\tRepeater size - "<< global_20.area.h <<
-    " \n\tRepeater spacing - " << global_20.area.w*1e3 << " (mm)"
-    " \n\tDelay - " << global_20.delay *1e6<<  " (ns/mm)"
-    " \n\tPowerD - " << global_20.power.readOp.dynamic *1e6<< " (nJ/mm)"
-    " \n\tPowerL - " << global_20.power.readOp.leakage << " (mW/mm)"
-    " \n\tPowerLgate - " << global_20.power.readOp.gate_leakage << " (mW/mm)\n";
-  cout << "\tWire width - " <<wire_width_init*1e6 << " microns\n";
-  cout << "\tWire spacing - " <<wire_spacing_init*1e6 << " microns\n";
+  cout << "  20% Overhead\n\tRepeater size - "<< tab.global_20.area.h <<
+    " \n\tRepeater spacing - " << tab.global_20.area.w*1e3 << " (mm)"
+    " \n\tDelay - " << tab.global_20.delay *1e6<<  " (ns/mm)"
+    " \n\tPowerD - " << tab.global_20.power.readOp.dynamic *1e6<< " (nJ/mm)"
+    " \n\tPowerL - " << tab.global_20.power.readOp.leakage << " (mW/mm)"
+    " \n\tPowerLgate - " << tab.global_20.power.readOp.gate_leakage << " (mW/mm)\n";
+  cout << "\tWire width - " <<tab.wire_width_init*1e6 << " microns\n";
+  cout << "\tWire spacing - " <<tab.wire_spacing_init*1e6 << " microns\n";
   cout <<endl;
-  cout << "  30% Overhead\n\tRepeater size - "<< global_30.area.h <<
-    " \n\tRepeater spacing - " << global_30.area.w*1e3 << " (mm)"
-    " \n\tDelay - " << global_30.delay *1e6<<  " (ns/mm)"
-    " \n\tPowerD - " << global_30.power.readOp.dynamic *1e6<< " (nJ/mm)"
-    " \n\tPowerL - " << global_30.power.readOp.leakage << " (mW/mm)"
-    " \n\tPowerLgate - " << global_30.power.readOp.gate_leakage << " (mW/mm)\n";
-  cout << "\tWire width - " <<wire_width_init*1e6 << " microns\n";
-  cout << "\tWire spacing - " <<wire_spacing_init*1e6 << " microns\n";
+  cout << "  30% Overhead\n\tRepeater size - "<< tab.global_30.area.h <<
+    " \n\tRepeater spacing - " << tab.global_30.area.w*1e3 << " (mm)"
+    " \n\tDelay - " << tab.global_30.delay *1e6<<  " (ns/mm)"
+    " \n\tPowerD - " << tab.global_30.power.readOp.dynamic *1e6<< " (nJ/mm)"
+    " \n\tPowerL - " << tab.global_30.power.readOp.leakage << " (mW/mm)"
+    " \n\tPowerLgate - " << tab.global_30.power.readOp.gate_leakage << " (mW/mm)\n";
+  cout << "\tWire width - " <<tab.wire_width_init*1e6 << " microns\n";
+  cout << "\tWire spacing - " <<tab.wire_spacing_init*1e6 << " microns\n";
   cout <<endl;
   cout << "  Low-swing wire (1 mm) - Note: Unlike repeated wires, \n\tdelay and power "
             "values of low-swing wires do not\n\thave a linear relationship with length." <<
-      " \n\tdelay - " << low_swing.delay *1e9<<  " (ns)"
-      " \n\tpowerD - " << low_swing.power.readOp.dynamic *1e9<< " (nJ)"
-      " \n\tPowerL - " << low_swing.power.readOp.leakage << " (mW)"
-      " \n\tPowerLgate - " << low_swing.power.readOp.gate_leakage << " (mW)\n";
-  cout << "\tWire width - " <<wire_width_init * 2 /* differential */<< " microns\n";
-  cout << "\tWire spacing - " <<wire_spacing_init * 2 /* differential */<< " microns\n";
+      " \n\tdelay - " << tab.low_swing.delay *1e9<<  " (ns)"
+      " \n\tpowerD - " << tab.low_swing.power.readOp.dynamic *1e9<< " (nJ)"
+      " \n\tPowerL - " << tab.low_swing.power.readOp.leakage << " (mW)"
+      " \n\tPowerLgate - " << tab.low_swing.power.readOp.gate_leakage << " (mW)\n";
+  cout << "\tWire width - " <<tab.wire_width_init * 2 /* differential */<< " microns\n";
+  cout << "\tWire spacing - " <<tab.wire_spacing_init * 2 /* differential */<< " microns\n";
   cout <<endl;
   cout <<endl;
 
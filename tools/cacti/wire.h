@@ -41,6 +41,43 @@
 #include "cacti_interface.h"
 #include <iostream>
 #include <list>
+#include <vector>
+
+// Repeated-wire models built once per solve by the initialising Wire()
+// constructor and shared by every wire of that solve.
+class WireTables
+{
+  public:
+    WireTables():initialized(0), wire_width_init(0), wire_spacing_init(0) {}
+
+    int initialized;
+    // the following values are for peripheral global technology
+    // specified in the input config file
+    Component global;
+    Component global_5;
+    Component global_10;
+    Component global_20;
+    Component global_30;
+    Component low_swing;
+    double wire_width_init;
+    double wire_spacing_init;
+    // Wire::tables_key() they were built for, empty if they are not shared
+    vector<double> key;
+};
+
+// Operating points of a repeated wire swept by init_wire(), one per repeater
+// spacing and size, kept column-wise so they are filled and scanned as
+// plain arrays.
+class RepeatedWireTable
+{
+  public:
+    vector<double> spacing; // m
+    vector<double> size;
+    vector<double> delay;
+    vector<double> dynamic;
+    vector<double> leakage;
+    vector<double> gate_leakage;
+};
 
 class Wire : public Component
 {
@@ -84,14 +121,6 @@ class Wire : public Component
     {
       in_rise_time = rt;
     }
-    static Component global;
-    static Component global_5;
-    static Component global_10;
-    static Component global_20;
-    static Component global_30;
-    static Component low_swing;
-    static double wire_width_init;
-    static double wire_spacing_init;
     void print_wire();
 
   private:
@@ -104,9 +133,13 @@ class Wire : public Component
     double w_scale, s_scale;
     double resistivity;
     powerDef wire_model (double space, double size, double *delay);
-    list <Component> repeated_wire;
-    void update_fullswing();
-    static int initialized;
+    void wire_model_batch(double space, int n, const double *size,
+                          const double *i_sub, const double *i_g, double *delay,
+                          double *dynamic, double *leakage, double *gate_leakage);
+    void update_fullswing(const RepeatedWireTable & rw);
+    bool tables_key(vector<double> & key);
+    // wire models of the solve bound to the calling thread
+    static WireTables & tables() { return *g_ctx->wire; }
 
 
     //low-swing